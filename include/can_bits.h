@@ -0,0 +1,136 @@
+#ifndef CAN_BITS_H
+#define CAN_BITS_H
+
+#include <stdint.h>
+
+// Signal extraction from a CAN payload.
+//
+// Big-endian (Motorola) signals, which is everything Haltech sends, number
+// bits MSB-first across the frame: bit 0 is the top bit of byte 0, bit 8 the
+// top bit of byte 1, and startBit is the signal's most significant bit.
+// Little-endian (Intel) signals number bits LSB-first within each byte
+// (byte * 8 + bit) and startBit is the signal's least significant bit.
+
+typedef enum
+{
+  CAN_BIG_ENDIAN,
+  CAN_LITTLE_ENDIAN,
+} CanByteOrder_e;
+
+typedef int32_t (*SignalDecoder)(const uint8_t *data);
+
+// Bit argument of byteFieldLayout() for a field of whole bytes
+#define CAN_NO_BIT 0xFF
+
+// Bit argument of byteFieldLayout() for a field of length bits whose most
+// significant bit is bit msb (0 = LSB) of firstByte, running on into the
+// following bytes. A one bit flag is just its bit number.
+#define CAN_BITS(msb, length) ((((length) - 1) << 3) | (msb))
+
+struct CanBitLayout
+{
+  uint8_t startBit;
+  uint8_t length;
+};
+
+// Big-endian layout of payload bytes firstByte..lastByte, the way Haltech
+// documents its signals, or of the CAN_BITS() field starting in firstByte
+constexpr CanBitLayout byteFieldLayout(uint8_t firstByte, uint8_t lastByte, uint8_t bits)
+{
+  if (bits != CAN_NO_BIT) {
+    return {(uint8_t)(firstByte * 8 + (7 - (bits & 7))), (uint8_t)((bits >> 3) + 1)};
+  }
+  return {(uint8_t)(firstByte * 8), (uint8_t)((lastByte - firstByte + 1) * 8)};
+}
+
+// Last payload byte a signal touches
+constexpr uint8_t signalLastByte(uint8_t startBit, uint8_t length)
+{
+  return (startBit + length - 1) / 8;
+}
+
+// Sign extend the low `length` bits of value
+inline int32_t signExtend(uint32_t value, uint8_t length)
+{
+  if (length >= 32) {
+    return (int32_t)value;
+  }
+  uint32_t signBit = 1UL << (length - 1);
+  return (int32_t)((value ^ signBit) - signBit);
+}
+
+// Generic extractor for signals only known at runtime
+inline int32_t extractBits(const uint8_t *data, uint8_t startBit, uint8_t length, CanByteOrder_e order, bool isSigned)
+{
+  uint8_t firstByte = startBit / 8;
+  uint8_t lastByte = signalLastByte(startBit, length);
+  uint64_t raw = 0;
+  uint8_t shift;
+
+  if (order == CAN_BIG_ENDIAN) {
+    for (uint8_t i = firstByte; i <= lastByte; i++) {
+      raw = (raw << 8) | data[i];
+    }
+    shift = (lastByte + 1) * 8 - (startBit + length);
+  } else {
+    for (int8_t i = lastByte; i >= firstByte; i--) {
+      raw = (raw << 8) | data[i];
+    }
+    shift = startBit % 8;
+  }
+
+  uint32_t value = (uint32_t)(raw >> shift);
+  if (length < 32) {
+    value &= (1UL << length) - 1;
+  }
+  return isSigned ? signExtend(value, length) : (int32_t)value;
+}
+
+// Bytes First..Last of the payload assembled into an integer, unrolled at
+// compile time
+template <uint8_t First, uint8_t Last>
+struct CanBytes
+{
+  static inline uint32_t bigEndian(const uint8_t *data)
+  {
+    return (CanBytes<First, Last - 1>::bigEndian(data) << 8) | data[Last];
+  }
+  static inline uint32_t littleEndian(const uint8_t *data)
+  {
+    return (CanBytes<First + 1, Last>::littleEndian(data) << 8) | data[First];
+  }
+};
+
+template <uint8_t Byte>
+struct CanBytes<Byte, Byte>
+{
+  static inline uint32_t bigEndian(const uint8_t *data) { return data[Byte]; }
+  static inline uint32_t littleEndian(const uint8_t *data) { return data[Byte]; }
+};
+
+// Extractor specialised for a signal layout known at compile time. Only the
+// bytes the signal covers are loaded and the shift, mask and sign extension
+// fold into constants, leaving straight-line code.
+template <uint8_t StartBit, uint8_t Length, CanByteOrder_e Order, bool Signed>
+int32_t extractSignal(const uint8_t *data)
+{
+  static_assert(Length >= 1 && Length <= 32, "Signals are 1 to 32 bits long");
+  static_assert(signalLastByte(StartBit, Length) < 8, "Signal runs past the end of the payload");
+  static_assert(signalLastByte(StartBit, Length) - StartBit / 8 < 4, "Signal spans more than 4 bytes");
+
+  const uint8_t firstByte = StartBit / 8;
+  const uint8_t lastByte = signalLastByte(StartBit, Length);
+  const uint8_t shift = Order == CAN_BIG_ENDIAN ? (lastByte + 1) * 8 - (StartBit + Length) : StartBit % 8;
+  const uint32_t mask = Length >= 32 ? 0xFFFFFFFFUL : (1UL << (Length % 32)) - 1;
+
+  uint32_t raw = Order == CAN_BIG_ENDIAN ? CanBytes<firstByte, lastByte>::bigEndian(data)
+                                         : CanBytes<firstByte, lastByte>::littleEndian(data);
+  uint32_t value = (raw >> shift) & mask;
+  return Signed ? signExtend(value, Length) : (int32_t)value;
+}
+
+// Specialised decoder for whole-byte fields (1 to 4 bytes) and big-endian
+// single bits, or nullptr if the layout needs the generic extractBits()
+SignalDecoder specializedDecoder(uint8_t startBit, uint8_t length, CanByteOrder_e order, bool isSigned);
+
+#endif // CAN_BITS_H
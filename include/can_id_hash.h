@@ -0,0 +1,56 @@
+#ifndef CAN_ID_HASH_H
+#define CAN_ID_HASH_H
+
+#include <stdint.h>
+
+// Perfect hash from the standard CAN IDs a set of signals arrive on to a
+// small table of slots, so the dispatch loop finds a frame's signals, or
+// rejects an ID nothing is read from, with a multiply and compare. The
+// search is constexpr so the built in signals' hash is found at compile
+// time. Formats are anything with a canId member.
+
+#define CAN_ID_HASH_BITS 7
+#define CAN_ID_HASH_SLOTS (1 << CAN_ID_HASH_BITS)
+#define CAN_ID_HASH_EMPTY 0xFFFF
+
+struct CanIdHash
+{
+  uint16_t multiplier;
+  uint8_t shift;
+};
+
+constexpr uint8_t canIdHashSlot(CanIdHash hash, uint32_t id)
+{
+  return ((id * hash.multiplier) >> hash.shift) & (CAN_ID_HASH_SLOTS - 1);
+}
+
+// True if no two different IDs share a slot
+template <typename Format>
+constexpr bool canIdHashIsPerfect(CanIdHash hash, const Format *formats, uint16_t count)
+{
+  uint16_t slotIds[CAN_ID_HASH_SLOTS] = {}; // ID + 1 of the slot's owner
+  for (uint16_t i = 0; i < count; i++) {
+    uint8_t slot = canIdHashSlot(hash, formats[i].canId);
+    if (slotIds[slot] != 0 && slotIds[slot] != formats[i].canId + 1) {
+      return false;
+    }
+    slotIds[slot] = formats[i].canId + 1;
+  }
+  return true;
+}
+
+// Multiplier 0 if there's none
+template <typename Format>
+constexpr CanIdHash findCanIdHash(const Format *formats, uint16_t count)
+{
+  for (uint16_t multiplier = 1; multiplier < 1024; multiplier += 2) {
+    for (uint8_t shift = 0; shift < 16; shift++) {
+      if (canIdHashIsPerfect(CanIdHash{multiplier, shift}, formats, count)) {
+        return {multiplier, shift};
+      }
+    }
+  }
+  return {0, 0};
+}
+
+#endif // CAN_ID_HASH_H
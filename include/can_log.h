@@ -0,0 +1,23 @@
+#ifndef CAN_LOG_H
+#define CAN_LOG_H
+
+#include <stdint.h>
+
+// One frame read back from a recorded CAN log
+struct CanLogFrame
+{
+  uint64_t timestampUs; // As recorded, only meaningful relative to other frames
+  uint32_t id;
+  bool extended;
+  uint8_t len;
+  uint8_t data[8];
+};
+
+// Parse one line of a candump log ("(1436509052.249713) can0 3E0#0102...")
+// or a Vector ASC log ("   12.345678 1  3E0   Rx   d 8 01 02 ..."). Returns
+// false for headers, comments, remote frames and anything else that isn't a
+// data frame. Kept free of Arduino dependencies so recordings can be parsed
+// off-target with the same code.
+bool parseCanLogLine(const char *line, CanLogFrame &frame);
+
+#endif // CAN_LOG_H
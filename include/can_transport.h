@@ -0,0 +1,62 @@
+#ifndef CAN_TRANSPORT_H
+#define CAN_TRANSPORT_H
+
+#include <stdint.h>
+
+struct CanFrame
+{
+  uint32_t id;
+  bool extended;
+  uint8_t len;
+  uint8_t data[8];
+};
+
+// Hardware acceptance filter derived from the CAN IDs in use, in the TWAI
+// register layout
+struct CanAcceptanceFilter
+{
+  uint32_t code;
+  uint32_t mask;
+  bool single;              // Single filter mode, otherwise dual filter mode
+  uint16_t acceptedIdCount; // Standard IDs that get through the hardware
+};
+
+// Receive-side health of the controller or socket
+struct CanTransportStatus
+{
+  uint32_t rxPending;         // Frames waiting to be read
+  uint32_t rxMissed;          // Frames lost because the receive queue was full
+  uint32_t rxOverrun;         // Frames lost in the controller's FIFO
+  uint32_t rxQueueFullEvents; // Times the receive queue filled up
+  uint32_t txPending;         // Frames queued with the controller, not yet on the wire
+  int64_t lastTxDoneUs;       // When the controller last finished sending a frame
+  uint32_t txFailed;          // Frames the controller gave up transmitting
+  uint32_t busOffCount;       // Times the controller went bus-off
+  bool busOff;                // Bus-off now, recovery in progress
+};
+
+// The bus as HaltechCan sees it, so the CAN stack isn't tied to the ESP32's
+// TWAI controller
+class CanTransport
+{
+public:
+  virtual ~CanTransport() {}
+
+  // (Re)start the bus accepting the standard IDs in ids. filter is the
+  // TWAI approximation of that set for transports that filter by code/mask.
+  virtual bool begin(long bitrate, const CanAcceptanceFilter &filter, const uint16_t *ids, uint16_t idCount) = 0;
+
+  // Block for up to timeoutMs until frames may be waiting. Also where the
+  // transport handles controller events such as bus-off recovery.
+  virtual bool waitForFrames(uint32_t timeoutMs) = 0;
+
+  // Read one waiting frame without blocking
+  virtual bool receive(CanFrame &frame) = 0;
+
+  // Queue a frame with the controller. A timeout of 0 never blocks.
+  virtual bool send(const CanFrame &frame, uint32_t timeoutMs) = 0;
+  virtual void clearReceiveQueue() = 0;
+  virtual bool getStatus(CanTransportStatus &status) = 0;
+};
+
+#endif // CAN_TRANSPORT_H
@@ -0,0 +1,93 @@
+#ifndef CAN_TX_SCHEDULER_H
+#define CAN_TX_SCHEDULER_H
+
+#include <stdint.h>
+#include "can_transport.h"
+
+// Transmit queues, highest priority first
+typedef enum
+{
+  CAN_TX_SDO,      // Replies the ECU is waiting on, and button edges
+  CAN_TX_PERIODIC, // Keep-alive and button state
+  CAN_TX_PRIORITY_COUNT
+} CanTxPriority_e;
+
+struct CanTxStats
+{
+  uint32_t sent;
+  uint32_t dropped;         // Queue was full
+  uint32_t coalesced;       // Replaced a queued frame with the same ID
+  uint32_t missedDeadlines; // Periods that went by without their frame going out
+  uint32_t minLatencyUs;    // Release to hand-off to the controller
+  uint32_t maxLatencyUs;
+  uint64_t totalLatencyUs;
+};
+
+// Rewrites a frame's payload just before it goes to the transport
+typedef void (*CanFrameRefresh)(CanFrame &frame, void *context);
+
+// Queues frames without blocking and hands them to the transport as it has
+// room, strictly by priority. Periodic frames are released on fixed
+// deadlines that don't drift with the caller's loop timing. Times are
+// microseconds from a monotonic clock supplied by the caller.
+class CanTxScheduler
+{
+public:
+  static const uint8_t QUEUE_LEN = 8;
+  static const uint8_t MAX_PERIODIC = 4;
+
+  CanTxScheduler();
+
+  // Register a periodic frame, first due one period from now. Returns its
+  // handle, or -1 if all periodic slots are taken.
+  int8_t addPeriodic(uint32_t periodUs, int64_t now);
+
+  // True once per period when the periodic frame should be queued
+  bool periodicDue(uint8_t handle, int64_t now);
+  int64_t releaseTime(uint8_t handle) const { return _periodic[handle].releaseUs; }
+  int64_t deadline(uint8_t handle) const { return _periodic[handle].dueUs; }
+
+  // Earliest time a periodic frame falls due
+  int64_t nextDueUs() const;
+
+  // Queue a frame released at releaseUs. A deadline of 0 means none. A
+  // periodic frame replaces one with the same ID still waiting to go out.
+  bool enqueue(const CanFrame &frame, CanTxPriority_e priority, int64_t releaseUs, int64_t deadlineUs = 0);
+
+  // Hand queued frames to the transport until it's full. Returns true if
+  // nothing is left waiting.
+  bool service(CanTransport &transport, int64_t now);
+
+  // Called on every frame as service() hands it over, for frames that carry
+  // state which may have changed while they waited
+  void setRefresh(CanFrameRefresh refresh, void *context);
+
+  const CanTxStats &stats(CanTxPriority_e priority) const { return _stats[priority]; }
+  void resetStats();
+
+private:
+  struct QueuedFrame
+  {
+    CanFrame frame;
+    int64_t releaseUs;
+    int64_t deadlineUs;
+  };
+
+  struct Periodic
+  {
+    uint32_t periodUs;
+    int64_t dueUs;
+    int64_t releaseUs;
+  };
+
+  QueuedFrame _queue[CAN_TX_PRIORITY_COUNT][QUEUE_LEN];
+  uint8_t _head[CAN_TX_PRIORITY_COUNT];
+  uint8_t _count[CAN_TX_PRIORITY_COUNT];
+  Periodic _periodic[MAX_PERIODIC];
+  uint8_t _periodicCount;
+  CanFrameRefresh _refresh;
+  void *_refreshContext;
+  CanTxStats _stats[CAN_TX_PRIORITY_COUNT];
+};
+
+#endif // CAN_TX_SCHEDULER_H
@@ -3,6 +3,49 @@
 
 // Common
 
+// The CAN receive task is pinned away from the Arduino loop (core 1) so slow
+// SPI redraws and web requests can't back up the TWAI receive queue
+#define CAN_TASK_CORE 0
+#define CAN_TASK_PRIORITY 10
+#define CAN_TASK_STACK_SIZE 4096
+
+// A signal is drawn as stale once it is this many update periods late
+#define STALE_TIMEOUT_MULTIPLIER 5
+// Whether stale signals raise a button's alert (beep/flash) like an out of
+// range value, for the default layout and layouts saved before it was a
+// per-button setting. Toggled per button in its menu.
+#define STALE_SIGNAL_ALERT true
+
+// Haltech keypad node IDs the dash emulates. Buttons are shared out in
+// order, KEYPAD_BUTTONS_PER_NODE (at most 16) to each node's button frame.
+#define KEYPAD_COUNT 1
+#define KEYPAD_NODE_IDS {0x0C}
+#define KEYPAD_BUTTONS_PER_NODE 16
+
+// Button values are drawn by a render pass at most this often. Updates
+// arriving in between only mark the button, so a 50 Hz signal costs at most
+// one draw per frame.
+#define RENDER_FPS 30
+// How button values are drawn, see value_renderer.h. The others are kept
+// to compare time and SPI bytes per value on the same session ('v').
+#define VALUE_RENDERING VALUE_RENDER_GLYPHS
+// Bytes per second the dash screen may send the panel before the traffic
+// report ('b', and 'p' after a replay) flags it, a fifth of a 40MHz SPI link.
+// Replay the same log at the same speed to compare changes.
+#define PANEL_TRAFFIC_BUDGET 1000000
+
+// Recorded candump/ASC log on SPIFFS that the replay serial commands play back
+#define CAN_REPLAY_FILE "/replay.log"
+// Frames decoded per pass of the CAN task when replaying as fast as possible
+#define CAN_REPLAY_BATCH_FRAMES 64
+
+// DBC file on SPIFFS read at boot. Signals named like a built in signal's
+// short name (or long name with underscores) replace its decoding, others
+// are added as new signals.
+#define SIGNAL_DBC_FILE "/signals.dbc"
+#define DBC_MAX_CUSTOM_SIGNALS 32
+// Period assumed for DBC messages without a GenMsgCycleTime attribute
+#define DBC_DEFAULT_PERIOD_MS 100
 
 #ifdef ESP32S3 // ESP32S3 specific
 	#define CAN_TX_PIN GPIO_NUM_2
@@ -0,0 +1,50 @@
+#ifndef DAMAGE_TRACKER_H
+#define DAMAGE_TRACKER_H
+
+#include <stdint.h>
+
+// Most rects held between flushes. Past this, a new rect is folded into
+// whichever held one grows least by taking it.
+#define DAMAGE_MAX_RECTS 16
+// Rects this close are merged when the bounding box wastes little, so the
+// 2 pixel gap between dash buttons doesn't split a row of them
+#define DAMAGE_MERGE_GAP 2
+
+struct DamageRect
+{
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+
+  int32_t area() const { return (int32_t)w * h; }
+  bool intersects(const DamageRect &other) const;
+  DamageRect intersection(const DamageRect &other) const; // Zero size if they don't
+};
+
+// Screen areas that need repainting, collected over a frame and handed
+// back merged and in the order the display's address window moves (top to
+// bottom, then left to right).
+class DamageTracker
+{
+public:
+  void add(int16_t x, int16_t y, int16_t w, int16_t h);
+  bool empty() const { return _count == 0; }
+  bool covers(const DamageRect &area) const; // Wholly inside one held rect
+
+  // Merge overlapping and adjacent rects and sort them. Call once per
+  // frame before reading them back.
+  void coalesce();
+  uint8_t count() const { return _count; }
+  const DamageRect &rect(uint8_t index) const { return _rects[index]; }
+  void clear() { _count = 0; }
+
+private:
+  DamageRect _rects[DAMAGE_MAX_RECTS];
+  uint8_t _count = 0;
+
+  static DamageRect merged(const DamageRect &a, const DamageRect &b);
+  static bool worthMerging(const DamageRect &a, const DamageRect &b);
+};
+
+#endif // DAMAGE_TRACKER_H
@@ -0,0 +1,40 @@
+#ifndef DBC_PARSER_H
+#define DBC_PARSER_H
+
+#include <stdint.h>
+#include "can_bits.h"
+
+#define DBC_NAME_LENGTH 24
+#define DBC_UNIT_LENGTH 12
+
+// A signal definition read from a DBC file, with the start bit converted to
+// the can_bits numbering for its byte order
+struct DbcSignal
+{
+  char name[DBC_NAME_LENGTH]; // Truncated if longer
+  char unit[DBC_UNIT_LENGTH];
+  uint8_t startBit;
+  uint8_t length;
+  CanByteOrder_e order;
+  bool isSigned;
+  float scale;
+  float offset;
+};
+
+// The subset of DBC the dash understands, one line at a time. Each parser
+// returns false for lines of any other kind. Kept free of Arduino
+// dependencies like can_log so definitions can be checked off-target.
+
+// BO_ 864 ECU_360: 8 ECU
+bool parseDbcMessage(const char *line, uint32_t &id, bool &extended);
+
+//  SG_ RPM : 7|16@0+ (1,0) [0|10000] "RPM" Dash
+// Signals in the message most recently passed to parseDbcMessage(). Returns
+// false for multiplexed signals and layouts can_bits can't extract (longer
+// than 32 bits or past the end of the payload).
+bool parseDbcSignal(const char *line, DbcSignal &signal);
+
+// BA_ "GenMsgCycleTime" BO_ 864 20;
+bool parseDbcCycleTime(const char *line, uint32_t &id, bool &extended, uint16_t &periodMs);
+
+#endif // DBC_PARSER_H
@@ -0,0 +1,18 @@
+#ifndef FIXED_POINT_TEXT_H
+#define FIXED_POINT_TEXT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define FIXED_POINT_MAX_DECIMALS 6
+
+// A displayed value as an integer count of its last shown digit, e.g.
+// 12.34 at 2 decimal places is 1234. Rounded half away from zero like
+// printf, and clamped to the int32 range.
+int32_t toFixedPoint(float value, uint8_t decimals);
+
+// Decimal text for a fixed point value, without going through printf.
+// Returns the length written, truncating to size - 1 characters.
+size_t formatFixedPoint(int32_t fixed, uint8_t decimals, char *out, size_t size);
+
+#endif // FIXED_POINT_TEXT_H
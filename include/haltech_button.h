@@ -2,6 +2,8 @@
 #define __HALTECH_BUTTON_H
 
 #include "haltech_can.h"
+#include "unit_conversion.h"
+#include "damage_tracker.h"
 #include <string>
 #include "TFT_eSPI.h"
 
@@ -14,6 +16,20 @@ typedef enum
 
 const unsigned long longPressThresholdTime = 1000;
 
+#define VALUE_TEXT_LENGTH 10
+
+// How often a value update changed what's on screen
+struct ValueDrawStats
+{
+  uint32_t updates;   // drawValue() calls on the dash screen
+  uint32_t redraws;   // Ones that reached the display
+  uint64_t drawUs;    // CPU time those took, formatting aside
+  uint64_t displayUs; // Part of it spent waiting on SPI
+  uint64_t spiBytes;  // Sent by the sprite and glyph paths
+};
+
+extern ValueDrawStats valueDrawStats;
+
 struct UnitOption {
     HaltechDisplayType_e type;
     HaltechUnit_e units[6]; // Maximum 6 units per value
@@ -25,7 +41,18 @@ typedef enum {
   DIRECTION_PREVIOUS,
 } menuSelectionDirection_e;
 
-static const UnitOption unitOptions[] = {
+// What's drawn below the value. Bar and graph span alertMin to alertMax.
+typedef enum {
+  WIDGET_NUMBER,  // Unit string only
+  WIDGET_BAR,
+  WIDGET_GRAPH,   // Sweeping sparkline, one column per update
+  WIDGET_SMOOTH_BAR, // Bar animated between CAN samples at the render rate
+  WIDGET_COUNT,
+} buttonWidget_e;
+
+#define WIDGET_MAX_COLUMNS 128
+
+static constexpr UnitOption unitOptions[] = {
     // Pressure measurements
     {HT_MANIFOLD_PRESSURE, {UNIT_KPA_ABS, UNIT_PSI_ABS, UNIT_KPA, UNIT_PSI}, 4},
     {HT_COOLANT_PRESSURE, {UNIT_KPA, UNIT_PSI}, 2},
@@ -36,7 +63,7 @@ static const UnitOption unitOptions[] = {
     {HT_BRAKE_PRESSURE_REAR, {UNIT_KPA, UNIT_PSI}, 2},
     {HT_NOS_PRESSURE_1, {UNIT_KPA, UNIT_PSI}, 2},
     {HT_BARO_PRESSURE, {UNIT_KPA_ABS, UNIT_PSI_ABS, UNIT_KPA, UNIT_PSI}, 4},
-    {HT_EXHAUST_MANIFOLD_PRESS, {UNIT_KPA, UNIT_PSI, UNIT_KPA, UNIT_PSI}, 4},
+    {HT_EXHAUST_MANIFOLD_PRESS, {UNIT_KPA, UNIT_PSI}, 2},
     
     // Speed measurements
     {HT_VEHICLE_SPEED, {UNIT_KPH, UNIT_MPH}, 2},
@@ -80,7 +107,7 @@ class HaltechButton
 {
 public:
   HaltechButton(void);
-  void initButton(TFT_eSPI *gfx, int16_t x1, int16_t y1, uint16_t w, uint16_t h, uint16_t outline, uint16_t fill, uint16_t textcolor, uint8_t textsize, HaltechDashValue* dashValue, HaltechUnit_e unit, int8_t decimalPlaces, buttonMode_e mode, float alertMin, float alertMax, bool alertBeepEnabled, bool alertFlashEnabled);
+  void initButton(TFT_eSPI *gfx, int16_t x1, int16_t y1, uint16_t w, uint16_t h, uint16_t outline, uint16_t fill, uint16_t textcolor, uint8_t textsize, const HaltechDashValue* dashValue, HaltechUnit_e unit, int8_t decimalPlaces, buttonMode_e mode, float alertMin, float alertMax, bool alertBeepEnabled, bool alertFlashEnabled, bool alertStaleEnabled, buttonWidget_e widget);
   void setLabelDatum(int16_t x_delta, int16_t y_delta, uint8_t datum = MC_DATUM);
   void drawButton();
   bool contains(int16_t x, int16_t y);
@@ -89,23 +116,30 @@ public:
   bool justPressed();
   bool justReleased();
   void drawValue();
-  void drawGraph();
-  void drawBar();
+  void drawGraph(float value, uint16_t color, uint16_t fill);
+  void drawBar(float value, uint16_t color, uint16_t fill);
   long pressedTime;
   buttonMode_e mode;
+  buttonWidget_e widget = WIDGET_NUMBER;
   bool toggledState = false;
   bool pressedState = false;
-  HaltechDashValue* dashValue = nullptr;
-  HaltechUnit_e displayUnit;
+  const HaltechDashValue* dashValue = nullptr;
+  HaltechUnit_e displayUnit;      // Set through setDisplayUnit() so displayConversion follows
   int8_t decimalPlaces = 1;
   float alertMin = -1;
   float alertMax = 1;
   bool alertConditionMet = false;
   bool alertBeepEnabled = false;
   bool alertFlashEnabled = false;
+  bool alertStaleEnabled = true; // A stale value raises the alert like an out of range one
   bool alertFlashState = false;
   bool wasDrawnInvertedFromAlert = false;
   void changeUnits(menuSelectionDirection_e direction);
+  void setDisplayUnit(HaltechUnit_e unit); // Call after changing dashValue too
+  void invalidate(); // Repaint the whole button with the next frame
+  DamageRect bounds() const { return {_x1, _y1, (int16_t)_w, (int16_t)_h}; }
+  bool isAnimating() const; // Needs drawing every frame even without a new value
+  float displayValue() const { return displayConversion.apply(dashValue->value()); }
 
 private:
 
@@ -119,9 +153,41 @@ private:
   bool lastDrawInverted;
   bool drawInverted;
   bool ledStates[3]; // Store states of the 3 "LEDs" like the real keypad (green, amber, red)
+  void drawValueDirect(const char *valueText, uint16_t text, uint16_t fill);
+
+  // Bar and graph are drawn incrementally; a full repaint is needed after
+  // drawButton() or when their colours change
+  bool _widgetDrawn = false;
+  uint16_t _widgetColor = 0;
+  uint16_t _widgetFill = 0;
+  int16_t _barLength = 0;                        // Pixels currently filled
+  uint8_t _graphSamples[WIDGET_MAX_COLUMNS];     // Height of each column's sample, ring indexed by x
+  uint8_t _graphHead = 0;                        // Column the next sample goes in
+  uint8_t _graphCount = 0;
+  unsigned long _graphLastUpdate = 0;            // dashValue update the last column came from
+  void widgetArea(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const;
+  int16_t widgetScale(float value, int16_t size) const;
+  void drawGraphColumn(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t column);
+
+  // Smooth bar: the last two samples, moved between over the time samples
+  // usually take to arrive. What's shown is always between them, so it
+  // can't overshoot what the ECU reported.
+  float _smoothFrom = 0;
+  float _smoothTo = 0;
+  float _smoothRate = 0;          // Units per ms from _smoothFrom to _smoothTo
+  float _smoothInterval = 0;      // Average ms between samples
+  unsigned long _smoothTime = 0;  // dashValue update _smoothTo came from
+  float smoothValue(float value);
+  float smoothValueAt(unsigned long now) const;
+  UnitConversion displayConversion = {1.0f, 0.0f}; // dashValue's incoming unit to displayUnit
   
   // Text padding optimization variables
   uint16_t _lastValueTextWidth = 0;  // Width of the last drawn value text
+
+  // What the value area shows, so an update that formats the same is skipped
+  char _lastValueText[VALUE_TEXT_LENGTH] = "";
+  uint16_t _lastValueTextColor = 0;
+  uint16_t _lastValueFillColor = 0;
 };
 
 #endif // __HALTECH_BUTTON_H
@@ -2,267 +2,30 @@
 #define HALTECH_CAN_H
 
 #include <Arduino.h>
+#include <atomic>
+#include "FS.h"
+#include "spsc_ring.h"
+#include "signal_watchdog.h"
+#include "can_bits.h"
+#include "can_log.h"
+#include "can_transport.h"
+#include "can_tx_scheduler.h"
+#include "sdo_server.h"
+#include "unknown_id_table.h"
+#include "dbc_parser.h"
+#include "config.h"
+
+// HaltechDashValue::bitfieldPos of a signal of whole bytes
+#define HT_NO_BIT CAN_NO_BIT
+// HaltechDashValue::bitfieldPos of a field narrower than its bytes; see
+// haltech_signals.def
+#define HT_BITS(msb, length) CAN_BITS(msb, length)
 
 typedef enum
 {
-    HT_RPM = 0,
-    HT_MANIFOLD_PRESSURE,
-    HT_THROTTLE_POSITION,
-    HT_COOLANT_PRESSURE,
-    HT_FUEL_PRESSURE,
-    HT_OIL_PRESSURE,
-    HT_ENGINE_DEMAND,
-    HT_WASTEGATE_PRESSURE,
-    HT_INJ_STATE_1_DUTY,
-    HT_INJ_STATE_2_DUTY,
-    HT_IGNITION_ANGLE,
-    HT_WHEEL_SLIP,
-    HT_WHEEL_DIFF,
-    HT_LAUNCH_CONTROL_END_RPM,
-    HT_INJ1_AVG_TIME, 
-    HT_INJ2_AVG_TIME, 
-    HT_INJ3_AVG_TIME, 
-    HT_INJ4_AVG_TIME, 
-    HT_WIDEBAND_SENSOR_1,
-    HT_WIDEBAND_SENSOR_2,
-    HT_WIDEBAND_SENSOR_3,
-    HT_WIDEBAND_SENSOR_4,
-    HT_TRIGGER_ERROR_COUNT,
-    HT_TRIGGER_COUNTER,
-    HT_TRIGGER_SYNC_LEVEL,
-    HT_KNOCK_LEVEL_1,
-    HT_KNOCK_LEVEL_2,
-    HT_BRAKE_PRESSURE_FRONT,
-    HT_NOS_PRESSURE_1,
-    HT_TURBO_SPEED_1,
-    HT_LATERAL_G,
-    HT_WHEEL_SPEED_FL,
-    HT_WHEEL_SPEED_FR,
-    HT_WHEEL_SPEED_RL,
-    HT_WHEEL_SPEED_RR,
-    HT_EXHAUST_CAM_ANGLE_1,
-    HT_EXHAUST_CAM_ANGLE_2,
-    HT_ENGINE_LIM_ACTIVE,
-    HT_LC_IGN_RETARD,
-    HT_LC_FUEL_ENRICH,
-    HT_LONGITUDINAL_G,
-    HT_GENERIC_OUTPUT_1_DUTY,
-    HT_BOOST_CONTROL_OUTPUT,
-    HT_VEHICLE_SPEED,
-    HT_INTAKE_CAM_ANGLE_1,
-    HT_INTAKE_CAM_ANGLE_2,
-    HT_FUEL_FLOW,
-    HT_FUEL_FLOW_RETURN,
-    HT_BATTERY_VOLTAGE,
-    HT_TARGET_BOOST_LEVEL,
-    HT_BARO_PRESSURE,
-    HT_EGT_SENSOR_1,
-    HT_EGT_SENSOR_2,
-    HT_AMBIENT_AIR_TEMP,
-    HT_RELATIVE_HUMIDITY,
-    HT_SPECIFIC_HUMIDITY,
-    HT_ABSOLUTE_HUMIDITY,
-    HT_COOLANT_TEMPERATURE,
-    HT_AIR_TEMPERATURE,
-    HT_FUEL_TEMPERATURE,
-    HT_OIL_TEMPERATURE,
-    HT_GEARBOX_OIL_TEMP,
-    HT_DIFF_OIL_TEMPERATURE,
-    HT_FUEL_COMPOSITION,
-    HT_FUEL_LEVEL,
-    HT_FUEL_TRIM_SHORT_TERM_1,
-    HT_FUEL_TRIM_SHORT_TERM_2,
-    HT_FUEL_TRIM_LONG_TERM_1,
-    HT_FUEL_TRIM_LONG_TERM_2,
-    HT_NEUTRAL_SWITCH,
-    HT_REVERSE_SWITCH,
-    HT_GEAR_SWITCH,
-    HT_DECEL_CUT_ACTIVE,
-    HT_TRANS_THROTTLE_ACTIVE,
-    HT_BRAKE_PEDAL_SWITCH,
-    HT_CLUTCH_SWITCH,
-    HT_OIL_PRESSURE_LIGHT,
-    HT_LAUNCH_CONTROL_ACTIVE,
-    HT_LAUNCH_CONTROL_SWITCH,
-    HT_AUX_RPM_LIMITER_ACTIVE,
-    HT_FLAT_SHIFT_SWITCH,
-    HT_TORQUE_REDUCT_ACTIVE,
-    HT_TC_ENABLED,
-    HT_TC_ACTIVE,
-    HT_AIR_CON_REQUEST,
-    HT_AIR_CON_OUTPUT,
-    HT_THERMO_FAN_4_ON,
-    HT_THERMO_FAN_3_ON,
-    HT_THERMO_FAN_2_ON,
-    HT_THERMO_FAN_1_ON,
-    HT_ROTARY_TRIM_POT_1,
-    HT_ROTARY_TRIM_POT_2,
-    HT_ROTARY_TRIM_POT_3,
-    HT_CHECK_ENGINE_LIGHT,
-    HT_BATTERY_LIGHT_ACTIVE,
-    HT_HAND_BRAKE_STATE,
-    HT_TRACTION_CONTROL_LIGHT,
-    HT_IGNITION_SWITCH,
-    HT_TURBO_TIMER_TIME_REM,
-    HT_TURB_TIMER_ENG_TIM_REM,
-    HT_PIT_SPEED_LIM_ERROR,
-    HT_PIT_SPEED_LIM_ACTIVE,
-    HT_PIT_SPEED_LIM_SW_STATE,
-    HT_ABS_ERROR,
-    HT_ABS_ACTIVE,
-    HT_ABS_ARMED,
-    HT_STEERING_WHEEL_ANGLE,
-    HT_DRIVESHAFT_RPM,
-    HT_NOS_PRESSURE_SENSOR_2,
-    HT_NOS_PRESSURE_SENSOR_3,
-    HT_NOS_PRESSURE_SENSOR_4,
-    HT_TURBO_SPEED_SENSOR_2,
-    HT_GENERIC_SENSOR_1,
-    HT_GENERIC_SENSOR_2,
-    HT_GENERIC_SENSOR_3,
-    HT_GENERIC_SENSOR_4,
-    HT_GENERIC_SENSOR_5,
-    HT_GENERIC_SENSOR_6,
-    HT_GENERIC_SENSOR_7,
-    HT_GENERIC_SENSOR_8,
-    HT_GENERIC_SENSOR_9,
-    HT_GENERIC_SENSOR_10,
-    HT_TARGET_LAMBDA,
-    HT_NITROUS_ST_1_OUT_STATE,
-    HT_NITROUS_ST_2_OUT_STATE,
-    HT_NITROUS_ST_3_OUT_STATE,
-    HT_NITROUS_ST_4_OUT_STATE,
-    HT_NITROUS_ST_5_OUT_STATE,
-    HT_NITROUS_ST_6_OUT_STATE,
-    HT_WATER_INJ_AD_OUT_STATE,
-    HT_TORQUE_MGMT_KNOB,
-    HT_GEARBOX_LINE_PRESSURE,
-    HT_INJ_STAGE_3_DUTY,
-    HT_INJ_STAGE_4_DUTY,
-    HT_CRANK_CASE_PRESSURE,
-    HT_RACE_TIMER,
-    HT_IGNITION_ANGLE_BANK_1,
-    HT_IGNITION_ANGLE_BANK_2,
-    HT_TM_RPM_TARGET,
-    HT_TM_RPM_ERROR,         
-    HT_TM_RPM_ERROR_IGN_CORR,
-    HT_TM_RPM_TIMED_IGN_CORR,
-    HT_TM_COMBINED_IGN_CORR, 
-    HT_WIDEBAND_SENSOR_5,    
-    HT_WIDEBAND_SENSOR_6,    
-    HT_WIDEBAND_SENSOR_7,    
-    HT_WIDEBAND_SENSOR_8,    
-    HT_WIDEBAND_SENSOR_9,    
-    HT_WIDEBAND_SENSOR_10,   
-    HT_WIDEBAND_SENSOR_11,   
-    HT_WIDEBAND_SENSOR_12,   
-    HT_SHOCK_TRAVEL_FL_UNCAL,
-    HT_SHOCK_TRAVEL_FR_UNCAL,
-    HT_SHOCK_TRAVEL_RL_UNCAL,
-    HT_SHOCK_TRAVEL_RR_UNCAL,
-    HT_SHOCK_TRAVEL_FL,      
-    HT_SHOCK_TRAVEL_FR,      
-    HT_SHOCK_TRAVEL_RL,      
-    HT_SHOCK_TRAVEL_RR,      
-    HT_ECU_TEMPERATURE,      
-    HT_WIDEBAND_OVERALL,
-    HT_WIDEBAND_BANK_1,
-    HT_WIDEBAND_BANK_2,
-    HT_GEAR_SELECTOR_POS,
-    HT_GEAR,
-    HT_PRESSURE_DIFFERENTIAL,
-    HT_ACCELERATOR_PEDAL_POS,
-    HT_EXHAUST_MANIFOLD_PRESS,
-    HT_CC_TARGET_SPEED,
-    HT_CC_LAST_TARGET_SPEED,
-    HT_CC_SPEED_ERROR,
-    HT_CC_STATE,
-    HT_CC_INPUT_STATE,
-    HT_TOTAL_FUEL_USED,
-    HT_ROLLING_AL_SW_STATE,
-    HT_AL_SWITCH_STATE,
-    HT_AL_OUTPUT_STATE,
-    HT_TC_SWITCH_STATE,
-    HT_PRI_FP_OUTPUT_STATE,
-    HT_AUX1_FP_OUTPUT_STATE,
-    HT_AUX2_FP_OUTPUT_STATE,
-    HT_AUX3_FP_OUTPUT_STATE,
-    HT_N2O_ENABLE1_SW_STATE,
-    HT_N2O_ENABLE1_OUT_STATE,
-    HT_N2O_ENABLE2_SW_STATE,
-    HT_N2O_ENABLE2_OUT_STATE,
-    HT_N2O_ENABLE3_SW_STATE,
-    HT_N2O_ENABLE3_OUT_STATE,
-    HT_N2O_ENABLE4_SW_STATE,
-    HT_N2O_ENABLE4_OUT_STATE,
-    HT_N2O_OVR1_SW_STATE,      
-    HT_N2O_OVR1_OUT_STATE,     
-    HT_N2O_OVR2_SW_STATE,      
-    HT_N2O_OVR2_OUT_STATE,     
-    HT_N2O_OVR3_SW_STATE,      
-    HT_N2O_OVR3_OUT_STATE,     
-    HT_N2O_OVR4_SW_STATE,      
-    HT_N2O_OVR4_OUT_STATE,     
-    HT_WATER_INJ_EN_SWITCH,    
-    HT_WATER_INJ_EN_OUTPUT,    
-    HT_WATER_INJ_OVR_SWITCH,   
-    HT_WATER_INJ_OVR_OUTPUT,   
-    HT_CUT_PERCENTAGE_METHOD,  
-    HT_VERTICAL_G,             
-    HT_PITCH_RATE,             
-    HT_ROLL_RATE,              
-    HT_YAW_RATE,               
-    HT_PRIMARY_FUEL_PUMP_DUTY, 
-    HT_AUX1_FUEL_PUMP_DUTY,    
-    HT_AUX2_FUEL_PUMP_DUTY,    
-    HT_AUX3_FUEL_PUMP_DUTY,    
-    HT_BRAKE_PRESSURE_REAR,    
-    HT_BRAKE_PRESSURE_F_RATIO, 
-    HT_BRAKE_PRESSURE_R_RATIO, 
-    HT_BRAKE_PRESSURE_DIFF,    
-    HT_ENGINE_LIMIT_MAX,       
-    HT_CUT_PERCENTAGE,         
-    HT_ENGINE_LIMIT_FUNCTION,  
-    HT_RPM_LIMIT_FUNCTION,     
-    HT_CUT_PERCENTAGE_FUNC,    
-    HT_ENGINE_LIMIT_METHOD,    
-    HT_RPM_LIMIT_METHOD,       
-    HT_TIRE_PRESSURE_FL,       
-    HT_TIRE_PRESSURE_FR,       
-    HT_TIRE_PRESSURE_RL,       
-    HT_TIRE_PRESSURE_RR,       
-    HT_TIRE_TEMPERATURE_FL,    
-    HT_TIRE_TEMPERATURE_FR,    
-    HT_TIRE_TEMPERATURE_RL,    
-    HT_TIRE_TEMPERATURE_RR,    
-    HT_TIRE_SENSOR_BATTERY_FL, 
-    HT_TIRE_SENSOR_BATTERY_FR, 
-    HT_TIRE_SENSOR_BATTERY_RL, 
-    HT_TIRE_SENSOR_BATTERY_RR, 
-    HT_REC_TIRE_PRESSURE_F,    
-    HT_REC_TIRE_PRESSURE_R,    
-    HT_TIRE_LEAK_RR,           
-    HT_TIRE_LEAK_RL,           
-    HT_TIRE_LEAK_FR,           
-    HT_TIRE_LEAK_FL,           
-    HT_ENGINE_PROTECTION_SEV,  
-    HT_ENGINE_PROTECTION_REA,  
-    HT_LIGHT_STATE_PARK,
-    HT_LIGHT_STATE_HEAD,
-    HT_LIGHT_STATE_HIGH,
-    HT_LIGHT_STATE_LEFT,
-    HT_LIGHT_STATE_RIGHT,
-    HT_TOTAL_FUEL_USED_T1,     
-    HT_TRIP_METER_1,           
-    HT_GEN_OUT_STATES,
-    HT_CALCULATED_AIR_TEMP,
-    HT_WATER_INJ_ADV_DUTY,
-    HT_EXHAUST_CUTOUT_STATE,
-    HT_N2O_BOTTLE_OPEN_STATE,
-    HT_GEN_OL_MOTOR_CONT_1_ST,
-    HT_GEN_OL_MOTOR_CONT_2_ST,
-    HT_GEN_OL_MOTOR_CONT_3_ST,
-    HT_RESERVED,
+#define HT_SIGNAL(name, shortName, id, ...) HT_##id,
+#include "haltech_signals.def"
+#undef HT_SIGNAL
     HT_NONE
 } HaltechDisplayType_e;
 
@@ -315,7 +78,8 @@ typedef enum {
 
 extern const char* unitDisplayStrings[];
 
-// Each displayable field needs to have an instance of this struct
+// Each displayable field has an entry in dashValues. The table is constexpr
+// so it stays in flash; what's decoded at runtime lives in dashState.
 struct HaltechDashValue
 {
     const char* name;
@@ -327,32 +91,201 @@ struct HaltechDashValue
     HaltechUnit_e incomingUnit;     // Unit that the raw data will be converted to using the scale factor and offset
     float scale_factor;             // Multiply to scale the raw data
     float offset;                   // Add to raw data after scaling
-    unsigned long update_period;    // Period between expected updates from the ECU
+    unsigned long update_period;    // Ms between expected updates from the ECU, unless a DBC file says otherwise; see updatePeriod()
     bool is_signed;
-    unsigned long last_update_time; // Millis when last updated, start at max value
-    float scaled_value;             // Value after scaling has been applied
-    uint8_t bitfieldPos;
+    uint8_t bitfieldPos;            // Bit (0 = LSB) within start_byte for one bit flags, HT_BITS() for wider sub-byte fields, else HT_NO_BIT
     buttonMode_e buttonType;
 
-    float convertToUnit(HaltechUnit_e toUnit);
+    float value() const;
+    unsigned long lastUpdateTime() const;
+    uint16_t updatePeriod() const;  // Ms, from the signal table in use
+    bool hasUpdated() const;
+    bool isStale() const;
+};
+
+extern const HaltechDashValue dashValues[HT_NONE];
+
+// Built in signals are followed by any added from SIGNAL_DBC_FILE, whose
+// HaltechDisplayType_e values continue on from HT_NONE
+#define DASH_VALUE_CAPACITY (HT_NONE + DBC_MAX_CUSTOM_SIGNALS)
+uint16_t dashValueCount();
+const HaltechDashValue* dashValueAt(uint16_t index); // nullptr past dashValueCount()
+
+#define DASH_VALUE_UPDATED 0x01 // Received at least once
+#define DASH_VALUE_STALE   0x02 // No update within STALE_TIMEOUT_MULTIPLIER update periods
+
+// Runtime state of every signal, indexed by HaltechDisplayType_e. Parallel
+// arrays so applying an update only writes the few bytes that change.
+struct HaltechDashState
+{
+    float value[DASH_VALUE_CAPACITY];              // Value after scaling has been applied
+    unsigned long updateTime[DASH_VALUE_CAPACITY]; // Millis when last updated
+    uint8_t flags[DASH_VALUE_CAPACITY];
+};
+
+extern HaltechDashState dashState;
+
+inline float HaltechDashValue::value() const { return dashState.value[type]; }
+inline unsigned long HaltechDashValue::lastUpdateTime() const { return dashState.updateTime[type]; }
+inline bool HaltechDashValue::hasUpdated() const { return dashState.flags[type] & DASH_VALUE_UPDATED; }
+inline bool HaltechDashValue::isStale() const { return dashState.flags[type] & DASH_VALUE_STALE; }
+
+class HaltechButton;
+
+// One signal in the CAN ID dispatch table, with the buttons displaying it
+struct CanDispatchEntry
+{
+    const HaltechDashValue* dashValue;
+    SignalDecoder decode;   // Specialised extractor, or nullptr to use extractBits()
+    float scale;            // Copied from the signal's format so decoding stays out of flash
+    float offset;
+    uint16_t signal;        // Index into dashState
+    uint16_t subscribers;   // Bitmask of htButtons indices showing this signal
+    uint16_t periodMs;      // Expected update period, which a DBC file may have changed
+    uint8_t startBit;       // Layout of the signal in the payload, see can_bits.h
+    uint8_t bitLength;
+    bool isSigned;
+    bool littleEndian;
+    uint8_t webpageIndex;   // 255 if the value isn't streamed to the webpage
+    int8_t webpageDecimals;
+};
+
+// A decoded signal value handed from the CAN task to the UI loop
+struct CanSignalUpdate
+{
+    uint16_t entryIndex; // Index of the signal in the dispatch table
+    float value;
+    unsigned long timestamp;
+};
+
+#define CAN_UPDATE_QUEUE_LEN 1024
+
+// Reception statistics for one CAN ID, updated allocation-free by the CAN task
+#define CAN_JITTER_BUCKETS 8
+
+struct CanIdStats
+{
+    uint32_t frames;
+    uint32_t bytes;
+    uint32_t drops;           // Decoded updates lost to a full update queue
+    int64_t lastArrivalUs;    // esp_timer timestamp of the previous frame
+    uint32_t minIntervalUs;
+    uint32_t maxIntervalUs;
+    uint64_t totalIntervalUs;
+    uint32_t jitter[CAN_JITTER_BUCKETS]; // Inter-arrival deviation from update_period
+};
+
+// Progress of a recorded log being fed through the decoder in place of the bus
+struct CanReplayState
+{
+    File file;
+    uint16_t speed;            // Playback rate multiplier, 0 for as fast as possible
+    bool active;
+    bool haveFrame;            // frame has been read but isn't due yet
+    CanLogFrame frame;
+    uint64_t firstFrameUs;     // Log timestamp of the first frame
+    int64_t startUs;           // esp_timer time playback started
+    int64_t endUs;
+    uint32_t frames;
+    uint32_t skippedLines;     // Headers, comments and frames the dash can't use
+    uint32_t decodeTimeUs;
+    char line[128];
 };
 
-extern HaltechDashValue dashValues[HT_NONE];
+struct CanLatencyStats
+{
+    uint32_t count;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t totalUs;
+};
+
+struct CanSignalFormat;
 
 class HaltechCan
 {
 public:
     HaltechCan();
+    void useTransport(CanTransport &canTransport); // Call before begin(), defaults to the TWAI controller
+    bool loadSignalDefinitions(const char *path); // Call before begin() and before anything looks up signals
     bool begin(long baudRate = 1000E3);
-    void process(const unsigned long preemptLimit = 50);
+    void process(const unsigned long preemptLimit = 50); // Applies decoded updates on the UI loop
+    void rebuildDispatchTable(); // Call whenever a button's dashValue changes
+    void printDecodeStats(Print &out); // Since the last resetDecodeStats()
+    void resetDecodeStats();
+    void printIdStats(Print &out);
+    void printTxStats(Print &out);
+    void setDiscoveryMode(bool enabled); // Open the acceptance filter so every ID is seen
+    bool isDiscoveryMode() const { return discoveryMode; }
+    void clearUnknownIds() { unknownIdClearPending = true; }
+    uint16_t unknownIdSnapshot(UnknownIdEntry *out, uint16_t maxEntries) const { return unknownIds.snapshot(out, maxEntries); }
+    void printUnknownIds(Print &out);
+    void sendButtonEdge(uint8_t buttonIndex, int64_t touchSampleUs); // Call on any button press, release or toggle
+    bool startReplay(const char *path, uint16_t speed); // Decode a candump/ASC log from SPIFFS instead of the bus
+    void stopReplay();
+    void printReplayReport(Print &out);
 
 private:
     unsigned long lastProcessTime;
-    uint32_t extractValue(const uint8_t *buffer, uint8_t start_byte, uint8_t end_byte, bool is_signed);
-    void processCANData(long unsigned int rxId, unsigned char len, unsigned char *rxBuf);
+    // Written by the CAN task alone, zeroed there too when the UI asks with
+    // resetDecodeStats(), and read by the UI. Relaxed is enough for counters.
+    std::atomic<uint32_t> decodedFrameCount{0};  // Frames that matched at least one entry
+    std::atomic<uint32_t> decodedSignalCount{0}; // Signals unpacked from those frames
+    std::atomic<uint32_t> rejectedFrameCount{0}; // Frames let through by the hardware filter but not used
+    std::atomic<uint32_t> decodeTimeUs{0};       // Total time spent in processCANData
+    std::atomic<uint32_t> rxQueuePeak{0};        // Most frames seen waiting in the transport's RX queue
+    volatile bool decodeStatsResetPending = false;
+    unsigned long lastStatsPrintTime = 0;
+    CanTransport *transport;
+    CanTxScheduler txScheduler;      // Only touched by the CAN task
+    int8_t keepAliveTx = -1;
+    int8_t buttonInfoTx = -1;
+    bool txBacklog = false;          // Frames waiting for room in the controller
+    // The UI and CAN cores both read and write these, and 64 bit stores
+    // aren't atomic on the ESP32, so they're only touched under buttonEdgeLock
+    portMUX_TYPE buttonEdgeLock = portMUX_INITIALIZER_UNLOCKED;
+    int64_t buttonEdgeTouchUs = 0;   // Touch sample that caused the last edge
+    int64_t buttonEdgeHandoffUs = 0; // When its frame reached the controller
+    bool buttonEdgeOnWirePending = false;
+    std::atomic<uint8_t> buttonEdgePendingMask{0}; // Keypads whose edge frame the UI couldn't hand off
+    CanLatencyStats buttonEdgeHandoffLatency = {0, 0, 0, 0};
+    CanLatencyStats buttonEdgeWireLatency = {0, 0, 0, 0};
+    long bitrate = 1000E3;
+    TaskHandle_t rxTaskHandle = nullptr;
+    SemaphoreHandle_t driverLock;    // Held by the CAN task while it reinstalls the driver, and by UI calls into the transport
+    CanAcceptanceFilter acceptanceFilter = {0, 0, false, 0}; // Written by the UI loop under driverLock
+    volatile bool filterReinstallPending = false;
+    char replayPath[32];
+    uint16_t replaySpeed = 1;
+    volatile bool replayStartPending = false;
+    volatile bool replayStopPending = false;
+    CanReplayState replay;
+    SpscRing<CanSignalUpdate, CAN_UPDATE_QUEUE_LEN> updateQueue;
+    SignalWatchdog freshness;   // Indexed like the dispatch table
+    void buildSignalTable(const CanSignalFormat *formats = nullptr);
+    bool installDriver();
+    bool lockedTransportStatus(CanTransportStatus &status);
+    void updateAcceptanceFilter();
+    static void rxTask(void *arg);
+    HaltechButton* markSubscribersDirty(const CanDispatchEntry* entry);
+    void receiveFrames();
+    void openReplay();
+    bool readReplayFrame();
+    void replayFrames();
+    void finishReplay();
+    void processCANData(long unsigned int rxId, bool extended, unsigned char len, unsigned char *rxBuf);
+    SdoServer keypads[KEYPAD_COUNT];
+    UnknownIdTable unknownIds;       // IDs that got past the filter but aren't decoded
+    volatile bool unknownIdClearPending = false;
+    bool discoveryMode = false;
+    void buildButtonInfo(uint8_t keypad, CanFrame &frame);
+    static void refreshButtonInfo(CanFrame &frame, void *context);
+    void recordLatency(CanLatencyStats &stats, int64_t latencyUs);
     void SendButtonInfo();
     void SendKeepAlive();
-    bool sendMsgBuf(long unsigned int id, unsigned char ext, unsigned char len, byte *buf);
+    bool sendMsgBuf(long unsigned int id, unsigned char ext, unsigned char len, byte *buf, CanTxPriority_e priority, int64_t releaseUs, int64_t deadlineUs = 0);
 };
 
+extern HaltechCan htc;
+
 #endif // HALTECH_CAN_H
\ No newline at end of file
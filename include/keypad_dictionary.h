@@ -0,0 +1,18 @@
+#ifndef KEYPAD_DICTIONARY_H
+#define KEYPAD_DICTIONARY_H
+
+#include "sdo_server.h"
+
+// Object dictionary of an emulated Haltech keypad, sorted by index and subindex
+static constexpr SdoObject keypadDictionary[] = {
+  // Index  Sub   Flags                 Size  Value
+  {0x1018, 0x01, 0,                    4,    0x00000307, nullptr}, // Identity: vendor ID
+  {0x1018, 0x02, 0,                    4,    0x00003348, nullptr}, // Identity: product code
+  {0x1018, 0x03, 0,                    4,    0x00000001, nullptr}, // Identity: revision
+  {0x1018, 0x04, SDO_ADD_DEVICE_INDEX, 4,    0x0C19B8CF, nullptr}, // Identity: serial number
+  {0x1800, 0x01, SDO_ADD_NODE_ID,      4,    0x40000180, nullptr}, // TPDO1 COB-ID, the button frame
+};
+#define KEYPAD_OBJECT_COUNT (sizeof(keypadDictionary) / sizeof(keypadDictionary[0]))
+static_assert(sdoDictionarySorted(keypadDictionary, KEYPAD_OBJECT_COUNT), "keypadDictionary must be sorted by index and subindex");
+
+#endif // KEYPAD_DICTIONARY_H
@@ -0,0 +1,51 @@
+#ifndef PANEL_TRAFFIC_H
+#define PANEL_TRAFFIC_H
+
+#include "TFT_eSPI.h"
+
+#if defined(ILI9488_DRIVER)
+#define PANEL_BYTES_PER_PIXEL 3 // 18 bit colour over SPI
+#else
+#define PANEL_BYTES_PER_PIXEL 2
+#endif
+#define PANEL_WINDOW_BYTES 11   // CASET, RASET and RAMWR with their parameters
+
+struct PanelTraffic
+{
+  uint64_t pixels;
+  uint32_t windows;   // Address windows set, one per primitive or push
+  uint32_t ms;        // Time the counts were collected over
+
+  uint64_t bytes() const { return pixels * PANEL_BYTES_PER_PIXEL + (uint64_t)windows * PANEL_WINDOW_BYTES; }
+};
+
+// The display, counting the pixels and address windows its drawing sends
+// over SPI. TFT_eSPI builds its shapes and text out of the virtual
+// primitives overridden here, so those are counted as they're clipped to
+// the screen and viewport. Image pushes don't go through them and are
+// reported by whoever makes them with countWindow(); sprites draw into
+// their own memory and aren't counted until pushed.
+class CountingTFT : public TFT_eSPI
+{
+public:
+  using TFT_eSPI::TFT_eSPI;
+
+  void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) override;
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) override;
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+
+  // A window sent without the primitives above, e.g. pushImage()
+  void countWindow(int32_t x, int32_t y, int32_t w, int32_t h) { count(x, y, w, h); }
+
+  // Pixels and windows since the last call, with ms left zero
+  PanelTraffic takeTraffic();
+
+private:
+  uint64_t _pixels = 0;
+  uint32_t _windows = 0;
+
+  void count(int32_t x, int32_t y, int32_t w, int32_t h);
+};
+
+#endif // PANEL_TRAFFIC_H
@@ -25,8 +25,12 @@
 #include <TFT_eSPI.h>      // Hardware-specific library
 #include "haltech_button.h"
 #include "menu_button.h"
+#include "value_renderer.h"
+#include "damage_tracker.h"
 
-extern TFT_eSPI tft; // Invoke custom library
+extern CountingTFT tft; // Invoke custom library
+extern ValueRenderer valueRenderer;
+extern DamageTracker screenDamage; // Dash button repaints waiting for the next frame
 
 // This is the file name used to store the calibration data
 // You can change this to create new calibration files.
@@ -51,6 +55,10 @@ extern TFT_eSPI tft; // Invoke custom library
 #define LABEL1_FONT &FreeMonoBold12pt7b // Key label font 1
 #define LABEL2_FONT &FreeMono9pt7b    // Key label font 2
 
+// Region of a dash button the value is drawn in, between its name and unit
+#define VALUE_AREA_INSET 4   // From the left and right edges, clear of the outline
+#define VALUE_AREA_HEIGHT 22 // Centred on the value text
+
 // Numeric display box size and location
 #define DISP_X 1
 #define DISP_Y 10
@@ -78,6 +86,7 @@ typedef enum {
   STATE_MENU,
   STATE_VAL_SEL,
   STATE_BUTTON_TEXT_SEL,
+  STATE_DIAG,
   STATE_NONE,
 } ScreenState_e;
 
@@ -90,6 +99,7 @@ typedef enum {
   MENU_ALERT_MAX_UP,
   MENU_ALERT_BEEP,
   MENU_ALERT_FLASH,
+  MENU_ALERT_STALE,
   MENU_DECIMALS_DOWN,
   MENU_DECIMALS_UP,
   MENU_UNITS_BACK,
@@ -97,7 +107,11 @@ typedef enum {
   MENU_BUTTON_MODE_NONE,
   MENU_BUTTON_MODE_MOMENTARY,
   MENU_BUTTON_MODE_TOGGLE,
-  MENU_BUTTON_TEXT_SEL,
+  MENU_WIDGET_NUMBER,
+  MENU_WIDGET_BAR,
+  MENU_WIDGET_SMOOTH_BAR,
+  MENU_WIDGET_GRAPH,
+  MENU_DIAG,
   MENU_NONE,
 } menuButtonName_e;
 
@@ -124,14 +138,45 @@ typedef enum {
   VAL_SEL_NONE,
 } valSelButtonName_e;
 
+typedef enum {
+  DIAG_BACK,
+  DIAG_DISCOVERY,
+  DIAG_CLEAR,
+  DIAG_NONE,
+} diagButtonName_e;
+
 extern MenuButton menuButtons[MENU_NONE];
 extern MenuButton valSelButtons[VAL_SEL_NONE];
+extern MenuButton diagButtons[DIAG_NONE];
 
 extern ScreenState_e currScreenState;
 extern uint8_t buttonToModifyIndex;
 
+// Render passes that drew at least one button
+struct RenderStats
+{
+  uint32_t valueUpdates;  // Button values marked dirty by the decoder
+  uint32_t frames;
+  uint32_t buttonsDrawn;
+  uint64_t totalUs;
+  uint32_t maxUs;
+  uint32_t animationDraws; // Smooth bars drawn between samples with no new value
+  uint64_t animationUs;
+  uint32_t damageFrames;   // Frames that repainted whole buttons
+  uint32_t damageRects;    // Rects added, before merging
+  uint32_t damageWindows;  // Merged rects repainted
+  uint64_t damagePixels;   // Button pixels repainted through those windows
+  uint32_t maxDamagePixels;
+};
+
 void screenSetup();
 void screenLoop();
+void markButtonsDirty(uint16_t buttonMask); // Bit per htButtons index, drawn on the next render pass
+void printRenderStats(Print &out);
+void resetPanelTraffic();
+bool printPanelTraffic(Print &out); // False when the dash screen is over PANEL_TRAFFIC_BUDGET
+PanelTraffic panelTraffic(ScreenState_e state); // Sent while state was showing, since the last reset
+const char *screenStateName(ScreenState_e state);
 void touch_calibrate();
 void drawMenu();
 bool saveLayout();
@@ -145,4 +190,7 @@ void handleValSelValueSelection(int valueIndex);
 void navigateValSelToNextPage();
 void navigateValSelToPreviousPage();
 
+void setupDiagScreen();
+void drawDiagScreen();
+
 #endif // _SCREEN_H
\ No newline at end of file
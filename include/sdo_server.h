@@ -0,0 +1,90 @@
+#ifndef SDO_SERVER_H
+#define SDO_SERVER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Entry flags
+#define SDO_ADD_NODE_ID      0x01 // Value is relative to the node ID, like $NODEID in an EDS
+#define SDO_ADD_DEVICE_INDEX 0x02 // Value is offset by the device's index, for unique serial numbers
+
+// One object dictionary entry. Values up to 4 bytes are held inline and
+// read back expedited; longer ones point at data and use segmented uploads.
+struct SdoObject
+{
+  uint16_t index;
+  uint8_t subIndex;
+  uint8_t flags;
+  uint16_t size;
+  uint32_t value;
+  const char *data;
+};
+
+constexpr uint32_t sdoKey(uint16_t index, uint8_t subIndex)
+{
+  return ((uint32_t)index << 8) | subIndex;
+}
+
+// The dictionary is searched by halving, so it must be sorted by index then
+// subindex. Use in a static_assert next to the table.
+constexpr bool sdoDictionarySorted(const SdoObject *objects, size_t count)
+{
+  return count < 2 ||
+         (sdoKey(objects[0].index, objects[0].subIndex) < sdoKey(objects[1].index, objects[1].subIndex) &&
+          sdoDictionarySorted(objects + 1, count - 1));
+}
+
+#define SDO_ABORT_TOGGLE        0x05030000 // Toggle bit not alternated
+#define SDO_ABORT_COMMAND       0x05040001 // Command specifier not valid or unknown
+
+// CANopen SDO server for one node. Requests arrive on 0x600 + node and the
+// reply goes out on 0x580 + node. Expedited and segmented transfers are
+// supported in both directions; block transfers are refused.
+//
+// This emulates Haltech keypads, so it answers the way the original keypad
+// code did: reads of objects that aren't in the dictionary return zero
+// rather than aborting, and writes are acknowledged but not stored.
+class SdoServer
+{
+public:
+  SdoServer();
+  void begin(uint8_t nodeId, uint8_t deviceIndex, const SdoObject *dictionary, size_t objectCount);
+
+  uint8_t nodeId() const { return _nodeId; }
+  uint16_t requestId() const { return 0x600 + _nodeId; }
+  uint16_t replyId() const { return 0x580 + _nodeId; }
+
+  // Handle one request frame. Returns true if reply holds an 8 byte
+  // response to send.
+  bool handleRequest(const uint8_t *request, uint8_t len, uint8_t *reply);
+
+  const SdoObject *find(uint16_t index, uint8_t subIndex) const;
+
+private:
+  enum Transfer
+  {
+    SDO_IDLE,
+    SDO_UPLOAD,
+    SDO_DOWNLOAD,
+  };
+
+  uint32_t objectValue(const SdoObject *object) const;
+  void abort(uint8_t *reply, uint16_t index, uint8_t subIndex, uint32_t code);
+  bool initiateUpload(uint16_t index, uint8_t subIndex, uint8_t *reply);
+  bool uploadSegment(const uint8_t *request, uint8_t *reply);
+  bool downloadSegment(const uint8_t *request, uint8_t *reply);
+
+  const SdoObject *_dictionary;
+  size_t _objectCount;
+  uint8_t _nodeId;
+  uint8_t _deviceIndex;
+
+  Transfer _transfer;
+  const SdoObject *_object; // Object being uploaded
+  uint16_t _index;
+  uint8_t _subIndex;
+  uint16_t _offset;         // Bytes of the object already sent
+  uint8_t _toggle;          // Toggle bit expected in the next segment
+};
+
+#endif // SDO_SERVER_H
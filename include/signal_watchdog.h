@@ -0,0 +1,44 @@
+#ifndef SIGNAL_WATCHDOG_H
+#define SIGNAL_WATCHDOG_H
+
+#include <stdint.h>
+
+// Timer wheel tracking when each signal is due to go stale. Refreshing a
+// signal moves it to the slot of its new deadline in O(1), and each call to
+// expire() only walks the slots that elapsed since the previous call, so the
+// cost per tick is proportional to the number of signals expiring rather
+// than the number of signals tracked.
+class SignalWatchdog
+{
+public:
+  static const uint16_t MAX_SIGNALS = 512;
+  static const uint16_t SLOT_COUNT = 256;
+  static const uint16_t TICK_MS = 10;
+  static const uint16_t NONE = 0xFFFF;
+
+  SignalWatchdog();
+
+  // Signal was updated; it goes stale if not refreshed within timeoutMs.
+  // Returns true if the signal was stale until now.
+  bool refresh(uint16_t signal, unsigned long now, unsigned long timeoutMs);
+
+  // Collect signals whose deadline has passed, up to maxExpired of them.
+  // Returns how many were written to expired.
+  uint16_t expire(unsigned long now, uint16_t *expired, uint16_t maxExpired);
+
+  bool isStale(uint16_t signal) const { return _stale[signal]; }
+
+private:
+  void link(uint16_t signal);
+  void unlink(uint16_t signal);
+
+  uint16_t _slotHead[SLOT_COUNT];
+  uint16_t _next[MAX_SIGNALS];
+  uint16_t _prev[MAX_SIGNALS];
+  unsigned long _deadline[MAX_SIGNALS];
+  bool _scheduled[MAX_SIGNALS];
+  bool _stale[MAX_SIGNALS];
+  unsigned long _currentTick;
+};
+
+#endif // SIGNAL_WATCHDOG_H
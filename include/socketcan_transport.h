@@ -0,0 +1,39 @@
+#ifndef SOCKETCAN_TRANSPORT_H
+#define SOCKETCAN_TRANSPORT_H
+
+#ifdef __linux__
+
+#include "can_transport.h"
+
+// Linux SocketCAN interface such as can0 or vcan0, for running the CAN stack
+// off-target against cangen/canplayer. The bitrate is set on the interface
+// with `ip link`; begin() fails if a real interface runs at another one.
+class SocketCanTransport : public CanTransport
+{
+public:
+  explicit SocketCanTransport(const char *interfaceName);
+  ~SocketCanTransport();
+
+  bool begin(long bitrate, const CanAcceptanceFilter &filter, const uint16_t *ids, uint16_t idCount) override;
+  bool waitForFrames(uint32_t timeoutMs) override;
+  bool receive(CanFrame &frame) override;
+  bool send(const CanFrame &frame, uint32_t timeoutMs) override;
+  void clearReceiveQueue() override;
+  bool getStatus(CanTransportStatus &status) override;
+
+private:
+  void closeSocket();
+  bool checkBitrate(int ifIndex, long bitrate);
+
+  char _interfaceName[16];
+  int _socket;
+  uint32_t _rxMissed; // Kernel drop counter from SO_RXQ_OVFL
+  uint32_t _txFailed;
+  int64_t _lastTxDoneUs;
+  uint32_t _busOffCount;
+  bool _busOff;
+};
+
+#endif // __linux__
+
+#endif // SOCKETCAN_TRANSPORT_H
@@ -0,0 +1,74 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// Lock-free single-producer/single-consumer ring buffer. One task may push
+// while another pops without any locking, so it is safe to use between the
+// CAN task on core 0 and the UI loop on core 1. Capacity must be a power of 2.
+template <typename T, size_t Capacity>
+class SpscRing
+{
+  static_assert((Capacity & (Capacity - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+  // Producer side. Returns false and counts a drop if the ring is full.
+  bool push(const T &item)
+  {
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    uint32_t used = head - _tail.load(std::memory_order_acquire);
+    if (used >= Capacity) {
+      _dropCount++;
+      return false;
+    }
+
+    _items[head & (Capacity - 1)] = item;
+    _head.store(head + 1, std::memory_order_release);
+
+    if (used + 1 > _highWaterMark) {
+      _highWaterMark = used + 1;
+    }
+    return true;
+  }
+
+  // Consumer side. Returns false if the ring is empty.
+  bool pop(T &item)
+  {
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    item = _items[tail & (Capacity - 1)];
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  size_t size() const
+  {
+    return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+  }
+
+  static size_t capacity() { return Capacity; }
+  uint32_t dropCount() const { return _dropCount; }
+  uint32_t highWaterMark() const { return _highWaterMark; }
+
+  // Statistics are only written by the producer; resetting from the consumer
+  // can lose one concurrent update, which is fine for diagnostics.
+  void resetStats()
+  {
+    _dropCount = 0;
+    _highWaterMark = 0;
+  }
+
+private:
+  T _items[Capacity];
+  std::atomic<uint32_t> _head{0};
+  std::atomic<uint32_t> _tail{0};
+  volatile uint32_t _dropCount = 0;
+  volatile uint32_t _highWaterMark = 0;
+};
+
+#endif // SPSC_RING_H
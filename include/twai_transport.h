@@ -0,0 +1,29 @@
+#ifndef TWAI_TRANSPORT_H
+#define TWAI_TRANSPORT_H
+
+#include "can_transport.h"
+#include "driver/gpio.h"
+
+// ESP32 TWAI controller
+class TwaiTransport : public CanTransport
+{
+public:
+  TwaiTransport(gpio_num_t txPin, gpio_num_t rxPin);
+
+  bool begin(long bitrate, const CanAcceptanceFilter &filter, const uint16_t *ids, uint16_t idCount) override;
+  bool waitForFrames(uint32_t timeoutMs) override;
+  bool receive(CanFrame &frame) override;
+  bool send(const CanFrame &frame, uint32_t timeoutMs) override;
+  void clearReceiveQueue() override;
+  bool getStatus(CanTransportStatus &status) override;
+
+private:
+  gpio_num_t _txPin;
+  gpio_num_t _rxPin;
+  volatile uint32_t _rxQueueFullEvents;
+  volatile uint32_t _busOffCount;
+  volatile bool _busOff;
+  volatile int64_t _lastTxDoneUs;
+};
+
+#endif // TWAI_TRANSPORT_H
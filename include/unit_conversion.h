@@ -0,0 +1,115 @@
+#ifndef UNIT_CONVERSION_H
+#define UNIT_CONVERSION_H
+
+#include "haltech_can.h"
+
+// converted = value * scale + offset. A zero scale marks a pair of units
+// that can't be converted between.
+struct UnitConversion
+{
+    float scale;
+    float offset;
+
+    constexpr bool valid() const { return scale != 0.0f; }
+    // Kept as a plain multiply-add so GCC contracts it to a single madd.s
+    float apply(float value) const { return value * scale + offset; }
+};
+
+typedef enum {
+  UNIT_DIMENSION_NONE,
+  UNIT_DIMENSION_PRESSURE,
+  UNIT_DIMENSION_TEMPERATURE,
+  UNIT_DIMENSION_SPEED,
+  UNIT_DIMENSION_LENGTH,
+  UNIT_DIMENSION_VOLUME,
+  UNIT_DIMENSION_TIME,
+  UNIT_DIMENSION_MIXTURE,
+} UnitDimension_e;
+
+// How to get from a unit to the base unit of its dimension (kPa gauge,
+// Celsius, km/h, meters, liters, seconds, lambda). Worked in double, which
+// only ever runs at compile time.
+struct UnitBase
+{
+    UnitDimension_e dimension;
+    double scale;
+    double offset;
+};
+
+#define ATMOSPHERIC_KPA 101.325 // Sea level, for gauge/absolute pressure
+#define STOICHIOMETRIC_AFR 14.7 // Gasoline
+
+constexpr UnitBase unitBase(HaltechUnit_e unit)
+{
+  switch (unit) {
+    case UNIT_KPA:        return {UNIT_DIMENSION_PRESSURE, 1.0, 0.0};
+    case UNIT_KPA_ABS:    return {UNIT_DIMENSION_PRESSURE, 1.0, -ATMOSPHERIC_KPA};
+    case UNIT_PSI:        return {UNIT_DIMENSION_PRESSURE, 6.894757, 0.0};
+    case UNIT_PSI_ABS:    return {UNIT_DIMENSION_PRESSURE, 6.894757, -ATMOSPHERIC_KPA};
+    case UNIT_CELSIUS:    return {UNIT_DIMENSION_TEMPERATURE, 1.0, 0.0};
+    case UNIT_K:          return {UNIT_DIMENSION_TEMPERATURE, 1.0, -273.15};
+    case UNIT_FAHRENHEIT: return {UNIT_DIMENSION_TEMPERATURE, 5.0 / 9.0, -32.0 * 5.0 / 9.0};
+    case UNIT_KPH:        return {UNIT_DIMENSION_SPEED, 1.0, 0.0};
+    case UNIT_MPH:        return {UNIT_DIMENSION_SPEED, 1.609344, 0.0};
+    case UNIT_METERS:     return {UNIT_DIMENSION_LENGTH, 1.0, 0.0};
+    case UNIT_MM:         return {UNIT_DIMENSION_LENGTH, 0.001, 0.0};
+    case UNIT_INCHES:     return {UNIT_DIMENSION_LENGTH, 0.0254, 0.0};
+    case UNIT_FEET:       return {UNIT_DIMENSION_LENGTH, 0.3048, 0.0};
+    case UNIT_MILES:      return {UNIT_DIMENSION_LENGTH, 1609.344, 0.0};
+    case UNIT_LITERS:     return {UNIT_DIMENSION_VOLUME, 1.0, 0.0};
+    case UNIT_CC:         return {UNIT_DIMENSION_VOLUME, 0.001, 0.0};
+    case UNIT_GALLONS:    return {UNIT_DIMENSION_VOLUME, 3.785411784, 0.0};
+    case UNIT_SECONDS:    return {UNIT_DIMENSION_TIME, 1.0, 0.0};
+    case UNIT_MS:         return {UNIT_DIMENSION_TIME, 0.001, 0.0};
+    case UNIT_LAMBDA:     return {UNIT_DIMENSION_MIXTURE, 1.0, 0.0};
+    case UNIT_AFR:        return {UNIT_DIMENSION_MIXTURE, 1.0 / STOICHIOMETRIC_AFR, 0.0};
+    default:              return {UNIT_DIMENSION_NONE, 1.0, 0.0};
+  }
+}
+
+constexpr UnitConversion computeUnitConversion(HaltechUnit_e from, HaltechUnit_e to)
+{
+  if (from == to) {
+    return {1.0f, 0.0f};
+  }
+  UnitBase fromBase = unitBase(from);
+  UnitBase toBase = unitBase(to);
+  if (fromBase.dimension == UNIT_DIMENSION_NONE || fromBase.dimension != toBase.dimension) {
+    return {0.0f, 0.0f};
+  }
+  // to = (from * fromScale + fromOffset - toOffset) / toScale
+  return {(float)(fromBase.scale / toBase.scale), (float)((fromBase.offset - toBase.offset) / toBase.scale)};
+}
+
+struct UnitConversionMatrix
+{
+    UnitConversion conversions[UNIT_NONE][UNIT_NONE];
+};
+
+constexpr UnitConversionMatrix buildUnitConversionMatrix()
+{
+  UnitConversionMatrix matrix = {};
+  for (int from = 0; from < UNIT_NONE; from++) {
+    for (int to = 0; to < UNIT_NONE; to++) {
+      matrix.conversions[from][to] = computeUnitConversion((HaltechUnit_e)from, (HaltechUnit_e)to);
+    }
+  }
+  return matrix;
+}
+
+// Every pair of units, built by the compiler and kept in flash
+inline constexpr UnitConversionMatrix unitConversionMatrix = buildUnitConversionMatrix();
+
+static_assert(unitConversionMatrix.conversions[UNIT_KPA_ABS][UNIT_PSI].valid(), "Gauge and absolute pressure convert");
+static_assert(!unitConversionMatrix.conversions[UNIT_KPA][UNIT_CELSIUS].valid(), "Pressure doesn't convert to temperature");
+
+// Invalid for units outside HaltechUnit_e, as a corrupt layout file can hold
+inline UnitConversion unitConversion(HaltechUnit_e from, HaltechUnit_e to)
+{
+  if ((unsigned)from >= UNIT_NONE || (unsigned)to >= UNIT_NONE) {
+    return {0.0f, 0.0f};
+  }
+  return unitConversionMatrix.conversions[from][to];
+}
+
+#endif // UNIT_CONVERSION_H
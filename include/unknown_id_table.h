@@ -0,0 +1,64 @@
+#ifndef UNKNOWN_ID_TABLE_H
+#define UNKNOWN_ID_TABLE_H
+
+#include <stdint.h>
+
+// Traffic seen from one CAN ID the dash doesn't decode
+struct UnknownIdEntry
+{
+  uint32_t id;
+  bool extended;
+  uint8_t len;
+  uint8_t data[8];      // Last payload
+  uint8_t changedBytes; // Bit per payload byte that has differed between frames
+  uint32_t count;
+  int64_t firstSeenUs;
+  int64_t lastSeenUs;
+
+  // Average rate since the ID was first seen
+  float rateHz() const
+  {
+    return lastSeenUs > firstSeenUs ? (count - 1) * 1e6f / (lastSeenUs - firstSeenUs) : 0;
+  }
+};
+
+// Fixed-capacity open-addressing table of unrecognised CAN IDs. Recording a
+// frame is a hash and at most MAX_PROBE probes, however busy the bus is in
+// discovery mode; nothing is allocated. IDs that arrive once the table is
+// at MAX_SIZE, or whose probe run is already MAX_PROBE long, are only
+// counted.
+//
+// Written by the CAN task alone. Readers take a snapshot and may catch an
+// entry mid-update, which is fine for diagnostics.
+class UnknownIdTable
+{
+public:
+  static const uint16_t CAPACITY = 128; // Power of two
+  static const uint16_t MAX_SIZE = CAPACITY * 3 / 4; // Keeps probe runs short
+  static const uint8_t MAX_PROBE = 8;
+
+  UnknownIdTable();
+
+  void record(uint32_t id, bool extended, uint8_t len, const uint8_t *data, int64_t nowUs);
+  void clear();
+
+  // Copy up to maxEntries entries, busiest first. Returns how many.
+  uint16_t snapshot(UnknownIdEntry *out, uint16_t maxEntries) const;
+
+  uint16_t size() const { return _size; }
+  uint32_t overflowCount() const { return _overflowCount; }
+
+private:
+  static uint16_t slotFor(uint32_t key);
+
+  // Keys carry these flags so ID 0 isn't mistaken for an empty slot
+  static const uint32_t KEY_USED = 0x80000000;
+  static const uint32_t KEY_EXTENDED = 0x40000000;
+
+  uint32_t _keys[CAPACITY];
+  UnknownIdEntry _entries[CAPACITY];
+  volatile uint16_t _size;
+  volatile uint32_t _overflowCount;
+};
+
+#endif // UNKNOWN_ID_TABLE_H
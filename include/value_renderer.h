@@ -0,0 +1,85 @@
+#ifndef VALUE_RENDERER_H
+#define VALUE_RENDERER_H
+
+#include "TFT_eSPI.h"
+#include "panel_traffic.h"
+
+// How HaltechButton::drawValue gets its text to the display, selected by
+// VALUE_RENDERING in config.h
+#define VALUE_RENDER_DIRECT 0 // drawString straight to the display, padded over the old text
+#define VALUE_RENDER_SPRITE 1 // Whole value area drawn off-screen and pushed in one block
+#define VALUE_RENDER_GLYPHS 2 // Only changed characters, copied from a glyph atlas
+
+// Characters formatFixedPoint() produces, pre-rendered for the glyph atlas
+#define VALUE_GLYPH_CHARS "0123456789-."
+#define VALUE_GLYPH_COUNT 12
+// Colour schemes kept rendered at once: normal, alert-inverted and stale
+#define VALUE_GLYPH_SCHEMES 3
+
+// Draws button values off-screen. Two sprites alternate for whole-area
+// pushes; where TFT_eSPI supports DMA for the display the next value is
+// drawn while the previous one streams out. The ILI9488's 18 bit SPI mode
+// isn't supported by TFT_eSPI's DMA, so on this hardware each push blocks
+// until it's sent.
+//
+// For a monospaced value font, each character of the value font is also
+// rendered once per colour scheme into an atlas, and values are drawn as
+// fixed width cells copied from it, skipping cells that haven't changed.
+class ValueRenderer
+{
+public:
+  explicit ValueRenderer(CountingTFT *tft);
+  bool begin(int16_t width, int16_t height, const GFXfont *font); // After tft.init()
+  bool ready() const { return _ready; }
+  bool hasGlyphs() const { return _cellWidth > 0; }
+  bool usingDma() const { return _dma; }
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+  // Text centred on textX (relative to x) and the middle of the region,
+  // which is drawn with its top left corner at x, y
+  void draw(int16_t x, int16_t y, int16_t textX, const char *text, uint16_t textColor, uint16_t fillColor);
+
+  // As draw(), but only the cells whose character differs from previous,
+  // the text last drawn here in the same colours. previous nullptr redraws
+  // the whole region.
+  void drawCells(int16_t x, int16_t y, int16_t textX, const char *text, const char *previous, uint16_t textColor, uint16_t fillColor);
+
+  // Wait for a push still in flight. Call before drawing anything else or
+  // reading touch, which share the bus.
+  void finish();
+
+  // Time spent waiting on the display and bytes sent to it since the last call
+  void takeStats(uint32_t &blockedUs, uint32_t &spiBytes);
+
+private:
+  struct GlyphScheme
+  {
+    uint16_t textColor;
+    uint16_t fillColor;
+    bool built;
+  };
+
+  CountingTFT *_tft;
+  const GFXfont *_font = nullptr;
+  TFT_eSprite _sprites[2];
+  TFT_eSprite _glyphs[VALUE_GLYPH_SCHEMES]; // One cell per character, stacked vertically
+  GlyphScheme _schemes[VALUE_GLYPH_SCHEMES];
+  uint8_t _nextScheme = 0;
+  int16_t _cellWidth = 0;
+  uint8_t _next = 0;
+  int16_t _width = 0;
+  int16_t _height = 0;
+  bool _ready = false;
+  bool _dma = false;
+  bool _pushPending = false;
+  uint32_t _blockedUs = 0;
+  uint32_t _spiBytes = 0;
+
+  void setupGlyphs();
+  const uint16_t *glyphScheme(uint16_t textColor, uint16_t fillColor);
+  void push(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pixels);
+  void fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+};
+
+#endif // VALUE_RENDERER_H
@@ -26,6 +26,8 @@ void performOTAUpdate();
 void handleRoot();
 void handleOTAPage();
 void handleUpdateUpload();
+void handleCanStats();
+void handleUnknownIds();
 void updateWebpageValue(int index, float value, int precision);
 
 #endif // WEBPAGE_H
\ No newline at end of file
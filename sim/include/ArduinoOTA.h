@@ -0,0 +1,6 @@
+#ifndef ARDUINOOTA_H
+#define ARDUINOOTA_H
+
+// Pulled in by webpage.h; the simulator doesn't serve the webpage
+
+#endif // ARDUINOOTA_H
@@ -0,0 +1,54 @@
+#ifndef FS_H
+#define FS_H
+
+// Host stand-in for the ESP32 filesystem API, over files held in memory
+
+#include <Arduino.h>
+#include <memory>
+#include <vector>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs
+{
+
+class File : public Stream
+{
+public:
+  File() {}
+  File(std::shared_ptr<std::vector<uint8_t>> data, bool writable, size_t position)
+      : _data(data), _writable(writable), _position(position) {}
+
+  explicit operator bool() const { return _data != nullptr; }
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override;
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t read(uint8_t *buffer, size_t size);
+  size_t size() const { return _data != nullptr ? _data->size() : 0; }
+  void close() { _data = nullptr; }
+
+private:
+  std::shared_ptr<std::vector<uint8_t>> _data;
+  bool _writable = false;
+  size_t _position = 0;
+};
+
+class FS
+{
+public:
+  File open(const char *path, const char *mode = FILE_READ);
+  bool exists(const char *path);
+  bool remove(const char *path);
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif // FS_H
@@ -0,0 +1,213 @@
+#ifndef FREEMONO9PT7B_H
+#define FREEMONO9PT7B_H
+
+// Stand-in for TFT_eSPI's FreeMono9pt7b, which isn't available off-target:
+// DejaVuSansMono 9pt rendered as by fontconvert (141 dpi, 0x20-0x7E). Same
+// advance as FreeMono9pt7b; line advance set to match it too.
+
+const uint8_t FreeMono9pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xC3, 0xC0, 0xCF, 0x3C, 0xF3, 0xCC, 0x04, 0xC1, 0x90,
+  0x32, 0x04, 0xC7, 0xFE, 0xFF, 0xC6, 0x40, 0x98, 0xFF, 0xDF, 0xF8, 0xC8,
+  0x11, 0x02, 0x60, 0xCC, 0x00, 0x08, 0x04, 0x0F, 0x8F, 0xEC, 0x96, 0x43,
+  0x20, 0xF0, 0x0F, 0x04, 0xC2, 0x71, 0x3F, 0xF3, 0xF0, 0x20, 0x10, 0x08,
+  0x00, 0x78, 0x19, 0x83, 0x30, 0x66, 0x0C, 0xC0, 0xF3, 0x83, 0x83, 0x9E,
+  0x06, 0x60, 0xCC, 0x19, 0x83, 0x30, 0x3C, 0x1F, 0x0F, 0xC3, 0x00, 0xC0,
+  0x18, 0x0F, 0x06, 0xCF, 0x3B, 0xC7, 0xF0, 0xEE, 0x31, 0xF6, 0x3D, 0xC0,
+  0xFF, 0xC0, 0x32, 0x66, 0x4C, 0xCC, 0xCC, 0xC4, 0x66, 0x23, 0xC4, 0x66,
+  0x23, 0x33, 0x33, 0x32, 0x66, 0x4C, 0x11, 0x25, 0x51, 0xC3, 0x8A, 0xA4,
+  0x88, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C,
+  0x03, 0x00, 0x6D, 0xE8, 0xFF, 0xC0, 0xFC, 0x01, 0x81, 0x80, 0xC0, 0xC0,
+  0x60, 0x60, 0x30, 0x38, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x00,
+  0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x6F, 0x37, 0x83, 0xC1, 0xE0, 0xD8,
+  0xCF, 0xE3, 0xE0, 0x38, 0xF8, 0xD8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0xFF, 0xFF, 0x7E, 0x7F, 0xA0, 0xE0, 0x30, 0x18, 0x1C, 0x0C,
+  0x1C, 0x1C, 0x1C, 0x18, 0x1F, 0xFF, 0xF8, 0x7E, 0x7F, 0xA0, 0xE0, 0x30,
+  0x39, 0xF8, 0xFC, 0x07, 0x01, 0x80, 0xE0, 0xFF, 0xE7, 0xE0, 0x06, 0x07,
+  0x03, 0x82, 0xC3, 0x61, 0x31, 0x99, 0x8C, 0xFF, 0xFF, 0xC1, 0x80, 0xC0,
+  0x60, 0x7F, 0x3F, 0x98, 0x0C, 0x07, 0xE3, 0xF9, 0x0E, 0x03, 0x01, 0x80,
+  0xE0, 0xFF, 0xE7, 0xE0, 0x1E, 0x3F, 0x9C, 0x5C, 0x0C, 0x06, 0xF3, 0xFD,
+  0xC7, 0xC1, 0xE0, 0xD8, 0xEF, 0xE3, 0xE0, 0xFF, 0xFF, 0xC0, 0xC0, 0x60,
+  0x70, 0x30, 0x18, 0x18, 0x0C, 0x0E, 0x06, 0x03, 0x03, 0x00, 0x3E, 0x3F,
+  0xB0, 0x78, 0x3C, 0x1B, 0xF9, 0xFD, 0xC7, 0xC1, 0xE0, 0xF8, 0xEF, 0xE3,
+  0xE0, 0x3E, 0x3F, 0xB8, 0xD8, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x01, 0x81,
+  0xD1, 0xCF, 0xC3, 0xC0, 0xFC, 0x0F, 0xC0, 0x6D, 0x80, 0x1B, 0x7A, 0x00,
+  0x00, 0x83, 0xC7, 0x8E, 0x0C, 0x03, 0x80, 0x78, 0x0F, 0x00, 0x80, 0xFF,
+  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x80, 0x78, 0x0F, 0x00, 0xE0, 0x18,
+  0x38, 0xF1, 0xE0, 0x80, 0x00, 0x7D, 0xFE, 0x18, 0x30, 0xE3, 0x8E, 0x18,
+  0x30, 0x60, 0x01, 0x83, 0x00, 0x1E, 0x19, 0x98, 0x6C, 0xFC, 0xDE, 0x6F,
+  0x37, 0x9B, 0xCD, 0xE6, 0xF1, 0xEC, 0x06, 0x01, 0x80, 0x78, 0x1C, 0x0E,
+  0x07, 0x03, 0x83, 0x61, 0xB0, 0xD8, 0x6C, 0x7F, 0x3F, 0x98, 0xD8, 0x3C,
+  0x18, 0xFE, 0x7F, 0xB0, 0x78, 0x3C, 0x1F, 0xFB, 0xFD, 0x87, 0xC1, 0xE0,
+  0xF0, 0xFF, 0xEF, 0xE0, 0x1F, 0x1F, 0xDC, 0x3C, 0x0C, 0x06, 0x03, 0x01,
+  0x80, 0xC0, 0x70, 0x1C, 0x27, 0xF1, 0xF0, 0xFC, 0x7F, 0x31, 0xD8, 0x7C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE1, 0xF1, 0xDF, 0xCF, 0xC0, 0xFF, 0xFF,
+  0xF0, 0x18, 0x0C, 0x07, 0xFF, 0xFF, 0x80, 0xC0, 0x60, 0x30, 0x1F, 0xFF,
+  0xF8, 0xFF, 0xFF, 0xF0, 0x18, 0x0C, 0x07, 0xFB, 0xFD, 0x80, 0xC0, 0x60,
+  0x30, 0x18, 0x0C, 0x00, 0x1F, 0x1F, 0xDC, 0x3C, 0x0C, 0x06, 0x3F, 0x1F,
+  0x83, 0xC1, 0xF0, 0xD8, 0x67, 0xF1, 0xE0, 0xC1, 0xE0, 0xF0, 0x78, 0x3C,
+  0x1F, 0xFF, 0xFF, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x18, 0xFF, 0xFF,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x3E,
+  0x7C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0E, 0x1F, 0xE7, 0xC0, 0xC1,
+  0xB0, 0xCC, 0x63, 0x30, 0xD8, 0x3E, 0x0F, 0x83, 0x30, 0xCE, 0x31, 0x8C,
+  0x33, 0x0E, 0xC1, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01,
+  0x80, 0xC0, 0x60, 0x30, 0x1F, 0xFF, 0xF8, 0xE3, 0xF1, 0xF8, 0xFE, 0xFD,
+  0x5E, 0xAF, 0x77, 0x93, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x18, 0xE1, 0xF0,
+  0xFC, 0x7A, 0x3D, 0x1E, 0xCF, 0x27, 0x9B, 0xC5, 0xE2, 0xF1, 0xF8, 0x7C,
+  0x38, 0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
+  0xD8, 0xCF, 0xE3, 0xE0, 0xFE, 0x7F, 0xB0, 0xF8, 0x3C, 0x1E, 0x1F, 0xFD,
+  0xFC, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x00, 0x3E, 0x3F, 0x98, 0xD8, 0x3C,
+  0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8, 0xCF, 0xE3, 0xE0, 0x38, 0x0C,
+  0xFE, 0x3F, 0xCC, 0x3B, 0x06, 0xC1, 0xB0, 0xEF, 0xF3, 0xF8, 0xC3, 0x30,
+  0xEC, 0x1B, 0x06, 0xC0, 0xC0, 0x3E, 0x3F, 0xB8, 0x58, 0x0C, 0x03, 0xE0,
+  0xFC, 0x07, 0x01, 0x80, 0xE0, 0xFF, 0xE7, 0xE0, 0xFF, 0xFF, 0xF0, 0xC0,
+  0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+  0x00, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0,
+  0xF8, 0xEF, 0xE3, 0xE0, 0xC1, 0xE0, 0xD8, 0xCC, 0x66, 0x33, 0xB8, 0xD8,
+  0x6C, 0x36, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xC0, 0x78, 0x0F, 0x01, 0xB0,
+  0x66, 0xEC, 0xDD, 0x9A, 0xB3, 0x56, 0x6A, 0xCF, 0x78, 0xC6, 0x18, 0xC3,
+  0x18, 0xE3, 0xB1, 0x9D, 0x86, 0xC1, 0xC0, 0xE0, 0x70, 0x38, 0x3E, 0x1B,
+  0x1D, 0xCC, 0x6E, 0x38, 0xE1, 0xD8, 0x67, 0x38, 0xCC, 0x1E, 0x07, 0x80,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x00, 0xFF, 0xFF, 0xC0,
+  0xC0, 0xE0, 0x60, 0x60, 0x70, 0x30, 0x38, 0x38, 0x18, 0x1F, 0xFF, 0xF8,
+  0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF, 0xC0, 0x30, 0x18, 0x06,
+  0x03, 0x00, 0xC0, 0x60, 0x38, 0x0C, 0x06, 0x01, 0x80, 0xC0, 0x30, 0x18,
+  0x06, 0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF, 0x0C, 0x07, 0x83,
+  0x31, 0x86, 0xC0, 0xC0, 0xFF, 0xFF, 0xFC, 0xC6, 0x30, 0x3E, 0x3F, 0x90,
+  0xE0, 0x33, 0xFF, 0xFF, 0x07, 0x87, 0xFF, 0xBE, 0xC0, 0xC0, 0x60, 0x30,
+  0x18, 0x0D, 0xE7, 0xFB, 0x8F, 0x83, 0xC1, 0xE0, 0xF0, 0x7C, 0x7F, 0xF6,
+  0xF0, 0x1E, 0x7F, 0x61, 0xC0, 0xC0, 0xC0, 0xC0, 0x61, 0x7F, 0x1E, 0x01,
+  0x80, 0xC0, 0x60, 0x33, 0xDB, 0xFF, 0x8F, 0x83, 0xC1, 0xE0, 0xF0, 0x7C,
+  0x77, 0xF9, 0xEC, 0x3E, 0x3F, 0x98, 0xF8, 0x3F, 0xFF, 0xFF, 0x00, 0xC1,
+  0x7F, 0x8F, 0x80, 0x0F, 0x1F, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x3D, 0xBF, 0xF8, 0xF8, 0x3C, 0x1E, 0x0F,
+  0x07, 0xC7, 0x7F, 0x9E, 0xC0, 0x68, 0x77, 0xF1, 0xF0, 0xC0, 0x60, 0x30,
+  0x18, 0x0C, 0xE7, 0xFB, 0x8F, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E,
+  0x0C, 0x18, 0x18, 0x00, 0x00, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0xFF, 0xFF, 0x0C, 0x30, 0x00, 0x7D, 0xF0, 0xC3, 0x0C, 0x30, 0xC3,
+  0x0C, 0x30, 0xC3, 0xFB, 0xC0, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x3E, 0x3B,
+  0x39, 0xB8, 0xF8, 0x7E, 0x33, 0x18, 0xCC, 0x76, 0x1C, 0xF8, 0xF8, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0F, 0x0F, 0xDB,
+  0xBF, 0xFC, 0xCF, 0x33, 0xCC, 0xF3, 0x3C, 0xCF, 0x33, 0xCC, 0xF3, 0x30,
+  0xCE, 0x7F, 0xB8, 0xF8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xC0,
+  0x3E, 0x3F, 0xB8, 0xF8, 0x3C, 0x1E, 0x0F, 0x07, 0xC7, 0x7F, 0x1F, 0x00,
+  0xDE, 0x7F, 0xB8, 0xF8, 0x3C, 0x1E, 0x0F, 0x07, 0xC7, 0xFF, 0x6F, 0x30,
+  0x18, 0x0C, 0x06, 0x00, 0x3D, 0xBF, 0xF8, 0xF8, 0x3C, 0x1E, 0x0F, 0x07,
+  0xC7, 0x7F, 0x9E, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0xDD, 0xBF, 0x8E, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x80, 0x3F, 0x7F, 0xF0, 0x3F, 0x07, 0xF0, 0x3C,
+  0x07, 0x03, 0xFF, 0xBF, 0x00, 0x18, 0x0C, 0x06, 0x1F, 0xFF, 0xF8, 0xC0,
+  0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0xF0, 0xF8, 0xC1, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x0F, 0x07, 0xC7, 0x7F, 0x9C, 0xC0, 0xC1, 0xB1, 0x98, 0xCC,
+  0x63, 0x61, 0xB0, 0xD8, 0x38, 0x1C, 0x0E, 0x00, 0xC0, 0x78, 0x0D, 0x83,
+  0x32, 0x66, 0xEC, 0xD5, 0x8E, 0xE1, 0xDC, 0x31, 0x86, 0x30, 0xE3, 0xBB,
+  0x8D, 0x83, 0x81, 0xC0, 0xE0, 0xF8, 0x6C, 0x63, 0x71, 0xC0, 0xC1, 0xB1,
+  0x98, 0xCE, 0x63, 0x61, 0xB0, 0x78, 0x38, 0x0C, 0x0E, 0x06, 0x03, 0x07,
+  0x83, 0x80, 0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF,
+  0xFF, 0xC0, 0x0F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF0, 0xF0, 0x38,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0xF0, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0F, 0x0F, 0x1C, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0xF8, 0xF0, 0x78, 0xFF, 0xE1, 0xC0 };
+
+const GFXglyph FreeMono9pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
+  {     1,   2,  13,  11,    5,  -12 },   // 0x21 '!'
+  {     5,   6,   5,  11,    3,  -12 },   // 0x22 '"'
+  {     9,  11,  14,  11,    0,  -13 },   // 0x23 '#'
+  {    29,   9,  17,  11,    1,  -13 },   // 0x24 '$'
+  {    49,  11,  13,  11,    0,  -12 },   // 0x25 '%'
+  {    67,  10,  13,  11,    1,  -12 },   // 0x26 '&'
+  {    84,   2,   5,  11,    5,  -12 },   // 0x27 '''
+  {    86,   4,  16,  11,    4,  -13 },   // 0x28 '('
+  {    94,   4,  16,  11,    3,  -13 },   // 0x29 ')'
+  {   102,   7,   8,  11,    2,  -12 },   // 0x2A '*'
+  {   109,  10,  10,  11,    1,  -10 },   // 0x2B '+'
+  {   122,   3,   5,  11,    3,   -2 },   // 0x2C ','
+  {   124,   5,   2,  11,    3,   -5 },   // 0x2D '-'
+  {   126,   2,   3,  11,    4,   -2 },   // 0x2E '.'
+  {   127,   9,  15,  11,    1,  -12 },   // 0x2F '/'
+  {   144,   9,  13,  11,    1,  -12 },   // 0x30 '0'
+  {   159,   8,  13,  11,    2,  -12 },   // 0x31 '1'
+  {   172,   9,  13,  11,    1,  -12 },   // 0x32 '2'
+  {   187,   9,  13,  11,    1,  -12 },   // 0x33 '3'
+  {   202,   9,  13,  11,    1,  -12 },   // 0x34 '4'
+  {   217,   9,  13,  11,    1,  -12 },   // 0x35 '5'
+  {   232,   9,  13,  11,    1,  -12 },   // 0x36 '6'
+  {   247,   9,  13,  11,    1,  -12 },   // 0x37 '7'
+  {   262,   9,  13,  11,    1,  -12 },   // 0x38 '8'
+  {   277,   9,  13,  11,    1,  -12 },   // 0x39 '9'
+  {   292,   2,   9,  11,    4,   -8 },   // 0x3A ':'
+  {   295,   3,  11,  11,    3,   -8 },   // 0x3B ';'
+  {   300,   9,   9,  11,    1,   -9 },   // 0x3C '<'
+  {   311,   9,   6,  11,    1,   -8 },   // 0x3D '='
+  {   318,   9,   9,  11,    1,   -9 },   // 0x3E '>'
+  {   329,   7,  13,  11,    2,  -12 },   // 0x3F '?'
+  {   341,   9,  15,  11,    1,  -11 },   // 0x40 '@'
+  {   358,   9,  13,  11,    1,  -12 },   // 0x41 'A'
+  {   373,   9,  13,  11,    1,  -12 },   // 0x42 'B'
+  {   388,   9,  13,  11,    1,  -12 },   // 0x43 'C'
+  {   403,   9,  13,  11,    1,  -12 },   // 0x44 'D'
+  {   418,   9,  13,  11,    1,  -12 },   // 0x45 'E'
+  {   433,   9,  13,  11,    1,  -12 },   // 0x46 'F'
+  {   448,   9,  13,  11,    1,  -12 },   // 0x47 'G'
+  {   463,   9,  13,  11,    1,  -12 },   // 0x48 'H'
+  {   478,   8,  13,  11,    2,  -12 },   // 0x49 'I'
+  {   491,   7,  13,  11,    1,  -12 },   // 0x4A 'J'
+  {   503,  10,  13,  11,    1,  -12 },   // 0x4B 'K'
+  {   520,   9,  13,  11,    1,  -12 },   // 0x4C 'L'
+  {   535,   9,  13,  11,    1,  -12 },   // 0x4D 'M'
+  {   550,   9,  13,  11,    1,  -12 },   // 0x4E 'N'
+  {   565,   9,  13,  11,    1,  -12 },   // 0x4F 'O'
+  {   580,   9,  13,  11,    1,  -12 },   // 0x50 'P'
+  {   595,   9,  15,  11,    1,  -12 },   // 0x51 'Q'
+  {   612,  10,  13,  11,    1,  -12 },   // 0x52 'R'
+  {   629,   9,  13,  11,    1,  -12 },   // 0x53 'S'
+  {   644,  10,  13,  11,    1,  -12 },   // 0x54 'T'
+  {   661,   9,  13,  11,    1,  -12 },   // 0x55 'U'
+  {   676,   9,  13,  11,    1,  -12 },   // 0x56 'V'
+  {   691,  11,  13,  11,    0,  -12 },   // 0x57 'W'
+  {   709,   9,  13,  11,    1,  -12 },   // 0x58 'X'
+  {   724,  10,  13,  11,    1,  -12 },   // 0x59 'Y'
+  {   741,   9,  13,  11,    1,  -12 },   // 0x5A 'Z'
+  {   756,   4,  16,  11,    4,  -13 },   // 0x5B '['
+  {   764,   9,  15,  11,    1,  -12 },   // 0x5C '\'
+  {   781,   4,  16,  11,    3,  -13 },   // 0x5D ']'
+  {   789,  10,   5,  11,    1,  -12 },   // 0x5E '^'
+  {   796,  11,   2,  11,    0,    3 },   // 0x5F '_'
+  {   799,   4,   3,  11,    2,  -13 },   // 0x60 '`'
+  {   801,   9,  10,  11,    1,   -9 },   // 0x61 'a'
+  {   813,   9,  14,  11,    1,  -13 },   // 0x62 'b'
+  {   829,   8,  10,  11,    1,   -9 },   // 0x63 'c'
+  {   839,   9,  14,  11,    1,  -13 },   // 0x64 'd'
+  {   855,   9,  10,  11,    1,   -9 },   // 0x65 'e'
+  {   867,   8,  14,  11,    1,  -13 },   // 0x66 'f'
+  {   881,   9,  14,  11,    1,   -9 },   // 0x67 'g'
+  {   897,   9,  14,  11,    1,  -13 },   // 0x68 'h'
+  {   913,   8,  14,  11,    2,  -13 },   // 0x69 'i'
+  {   927,   6,  18,  11,    1,  -13 },   // 0x6A 'j'
+  {   941,   9,  14,  11,    1,  -13 },   // 0x6B 'k'
+  {   957,   8,  14,  11,    1,  -13 },   // 0x6C 'l'
+  {   971,  10,  10,  11,    1,   -9 },   // 0x6D 'm'
+  {   984,   9,  10,  11,    1,   -9 },   // 0x6E 'n'
+  {   996,   9,  10,  11,    1,   -9 },   // 0x6F 'o'
+  {  1008,   9,  14,  11,    1,   -9 },   // 0x70 'p'
+  {  1024,   9,  14,  11,    1,   -9 },   // 0x71 'q'
+  {  1040,   7,  10,  11,    3,   -9 },   // 0x72 'r'
+  {  1049,   9,  10,  11,    1,   -9 },   // 0x73 's'
+  {  1061,   9,  13,  11,    1,  -12 },   // 0x74 't'
+  {  1076,   9,  10,  11,    1,   -9 },   // 0x75 'u'
+  {  1088,   9,  10,  11,    1,   -9 },   // 0x76 'v'
+  {  1100,  11,  10,  11,    0,   -9 },   // 0x77 'w'
+  {  1114,   9,  10,  11,    1,   -9 },   // 0x78 'x'
+  {  1126,   9,  14,  11,    1,   -9 },   // 0x79 'y'
+  {  1142,   9,  10,  11,    1,   -9 },   // 0x7A 'z'
+  {  1154,   8,  17,  11,    2,  -13 },   // 0x7B '{'
+  {  1171,   2,  18,  11,    5,  -13 },   // 0x7C '|'
+  {  1176,   8,  17,  11,    2,  -13 },   // 0x7D '}'
+  {  1193,   9,   3,  11,    1,   -6 }    // 0x7E '~'
+};
+
+const GFXfont FreeMono9pt7b PROGMEM = {
+  (uint8_t  *)FreeMono9pt7bBitmaps,
+  (GFXglyph *)FreeMono9pt7bGlyphs,
+  0x20, 0x7E, 18 };
+
+#endif // FREEMONO9PT7B_H
@@ -0,0 +1,289 @@
+#ifndef FREEMONOBOLD12PT7B_H
+#define FREEMONOBOLD12PT7B_H
+
+// Stand-in for TFT_eSPI's FreeMonoBold12pt7b, which isn't available off-target:
+// DejaVuSansMono-Bold 12pt rendered as by fontconvert (141 dpi, 0x20-0x7E). Same
+// advance as FreeMonoBold12pt7b; line advance set to match it too.
+
+const uint8_t FreeMonoBold12pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFC, 0xE3, 0xF1, 0xF8, 0xFC,
+  0x7E, 0x3F, 0x1F, 0x8E, 0x07, 0x38, 0x1C, 0xE0, 0x63, 0x01, 0x9C, 0x7F,
+  0xFD, 0xFF, 0xF7, 0xFF, 0xC3, 0x18, 0x1C, 0xE0, 0x73, 0x0F, 0xFF, 0xBF,
+  0xFE, 0xFF, 0xF8, 0xE7, 0x03, 0x18, 0x0C, 0x60, 0x73, 0x80, 0x06, 0x00,
+  0x60, 0x06, 0x01, 0xFC, 0x7F, 0xEF, 0xFE, 0xE6, 0x2E, 0x60, 0xF6, 0x07,
+  0xF0, 0x7F, 0xC1, 0xFE, 0x06, 0xF0, 0x67, 0xC6, 0xFF, 0xFF, 0xFF, 0xE3,
+  0xF8, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x38, 0x01, 0xF0, 0x0C, 0x60,
+  0x31, 0x80, 0xC6, 0x01, 0xF0, 0x23, 0x83, 0x80, 0x38, 0x01, 0x80, 0x18,
+  0x01, 0x80, 0x1C, 0x1C, 0x40, 0xF8, 0x06, 0x30, 0x18, 0xC0, 0x63, 0x00,
+  0xF8, 0x01, 0xC0, 0x0F, 0xC0, 0x7F, 0x83, 0xFE, 0x0E, 0x08, 0x38, 0x00,
+  0xF0, 0x01, 0xC0, 0x07, 0x80, 0x3F, 0x01, 0xDE, 0x7E, 0x79, 0xF8, 0xF7,
+  0xE1, 0xFF, 0x83, 0xEF, 0x8F, 0x1F, 0xFE, 0x3F, 0xF8, 0x7E, 0xF0, 0xFF,
+  0xFF, 0xF8, 0x1C, 0xE3, 0x9C, 0x71, 0xCE, 0x38, 0xE3, 0x8E, 0x38, 0xE3,
+  0x8E, 0x1C, 0x71, 0xC3, 0x8E, 0x1C, 0xE1, 0xC7, 0x0E, 0x38, 0xE1, 0xC7,
+  0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xCE, 0x38, 0xE7, 0x1C, 0xE0, 0x06, 0x00,
+  0x60, 0x46, 0x2F, 0x6F, 0x7F, 0xE1, 0xF8, 0x1F, 0x87, 0xFE, 0xF6, 0xF4,
+  0x62, 0x06, 0x00, 0x60, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70,
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00,
+  0x70, 0x00, 0x7B, 0xDE, 0xF7, 0xBB, 0xDC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+  0x00, 0x70, 0x0E, 0x00, 0xE0, 0x1C, 0x01, 0xC0, 0x1C, 0x03, 0x80, 0x38,
+  0x07, 0x00, 0x70, 0x0E, 0x00, 0xE0, 0x1C, 0x01, 0xC0, 0x38, 0x03, 0x80,
+  0x38, 0x07, 0x00, 0x70, 0x0E, 0x00, 0x1F, 0x83, 0xFC, 0x7F, 0xE7, 0x0E,
+  0xF0, 0xEE, 0x07, 0xE0, 0x7E, 0x77, 0xE7, 0x7E, 0x77, 0xE0, 0x7E, 0x07,
+  0xE0, 0x7F, 0x0E, 0x70, 0xE7, 0xFE, 0x3F, 0xC1, 0xF0, 0x3E, 0x1F, 0xC3,
+  0xF8, 0x67, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38,
+  0x07, 0x00, 0xE0, 0x1C, 0x03, 0x87, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0x8F,
+  0xFC, 0xFF, 0xEC, 0x0F, 0x00, 0x70, 0x07, 0x00, 0x70, 0x0E, 0x01, 0xC0,
+  0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x1F, 0x87, 0xFE, 0x7F, 0xF4, 0x0F, 0x00, 0x70, 0x07, 0x00, 0xF1,
+  0xFE, 0x1F, 0x81, 0xFE, 0x00, 0xF0, 0x07, 0x00, 0x70, 0x07, 0xC0, 0xFF,
+  0xFE, 0xFF, 0xE3, 0xF8, 0x03, 0xC0, 0x3C, 0x07, 0xC0, 0xFC, 0x0D, 0xC1,
+  0xDC, 0x39, 0xC3, 0x9C, 0x71, 0xC6, 0x1C, 0xE1, 0xCF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7,
+  0x00, 0x70, 0x07, 0x00, 0x7F, 0x87, 0xFC, 0x7F, 0xE4, 0x1F, 0x00, 0x70,
+  0x07, 0x00, 0x70, 0x07, 0x81, 0xFF, 0xFE, 0xFF, 0xC3, 0xF0, 0x0F, 0xC1,
+  0xFE, 0x3F, 0xE7, 0x82, 0x70, 0x0E, 0x00, 0xEF, 0x8F, 0xFE, 0xFF, 0xEF,
+  0x0F, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0x70, 0xF7, 0xFE, 0x3F, 0xC1,
+  0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0xE0, 0x1E, 0x01, 0xC0,
+  0x1C, 0x03, 0x80, 0x38, 0x07, 0x80, 0x70, 0x0F, 0x00, 0xE0, 0x0E, 0x01,
+  0xC0, 0x1C, 0x03, 0x80, 0x1F, 0x87, 0xFE, 0x7F, 0xEF, 0x0F, 0xE0, 0x7E,
+  0x07, 0xF0, 0xF7, 0xFE, 0x1F, 0x87, 0xFE, 0xF0, 0xEE, 0x07, 0xE0, 0x7E,
+  0x07, 0xF0, 0xF7, 0xFE, 0x7F, 0xE1, 0xF8, 0x1F, 0x83, 0xFC, 0x7F, 0xEF,
+  0x0E, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xF0, 0xF7, 0xFF, 0x7F, 0xF1,
+  0xF7, 0x00, 0x70, 0x0E, 0x41, 0xE7, 0xFC, 0x7F, 0x83, 0xF0, 0xFF, 0xFF,
+  0x00, 0x00, 0xFF, 0xFF, 0x7B, 0xDE, 0xF0, 0x00, 0x00, 0x7B, 0xDE, 0xF7,
+  0xBB, 0xDC, 0x00, 0x10, 0x0F, 0x03, 0xF0, 0xFE, 0x7F, 0x0F, 0xC0, 0xE0,
+  0x0F, 0xC0, 0x7F, 0x00, 0xFE, 0x03, 0xF0, 0x0F, 0x00, 0x10, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x80, 0x0F, 0x00, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x00, 0x70, 0x3F,
+  0x0F, 0xE7, 0xF0, 0xFC, 0x0F, 0x00, 0x80, 0x00, 0x7F, 0x3F, 0xEF, 0xFE,
+  0x07, 0x01, 0xC0, 0x70, 0x38, 0x1C, 0x0F, 0x07, 0x03, 0x80, 0xE0, 0x38,
+  0x0E, 0x00, 0x00, 0xE0, 0x38, 0x0E, 0x00, 0x07, 0xE0, 0x3F, 0xC3, 0xC3,
+  0x8C, 0x07, 0x70, 0x0D, 0x87, 0xBE, 0x7F, 0xF1, 0x87, 0xCC, 0x0F, 0x30,
+  0x3C, 0xC0, 0xF3, 0x03, 0xC6, 0x1F, 0x9F, 0xF6, 0x1E, 0xDC, 0x00, 0x38,
+  0x00, 0x70, 0x20, 0xFF, 0xC0, 0xFC, 0x07, 0x80, 0x3F, 0x00, 0xFC, 0x03,
+  0xF0, 0x0F, 0xC0, 0x73, 0x81, 0xCE, 0x07, 0x38, 0x1C, 0xE0, 0xF3, 0xC3,
+  0x87, 0x0F, 0xFC, 0x7F, 0xF9, 0xFF, 0xE7, 0x03, 0x9C, 0x0E, 0xF0, 0x3F,
+  0xC0, 0xF0, 0xFF, 0x0F, 0xFC, 0xFF, 0xEE, 0x1E, 0xE0, 0xEE, 0x0E, 0xE1,
+  0xEF, 0xFC, 0xFF, 0x0F, 0xFE, 0xE0, 0xEE, 0x07, 0xE0, 0x7E, 0x07, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xEF, 0xF8, 0x0F, 0xC3, 0xFC, 0xFF, 0xBC, 0x37, 0x03,
+  0xE0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0F, 0x00, 0xE0,
+  0x5E, 0x19, 0xFF, 0x1F, 0xE1, 0xF8, 0xFE, 0x0F, 0xF8, 0xFF, 0xCE, 0x1E,
+  0xE0, 0xEE, 0x0F, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07,
+  0xE0, 0xFE, 0x0E, 0xE1, 0xEF, 0xFC, 0xFF, 0x8F, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xFE, 0xFF, 0xDF, 0xFB, 0x80,
+  0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0xFE, 0xFF, 0xDF, 0xFB,
+  0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x00, 0x0F,
+  0xC1, 0xFE, 0x3F, 0xE7, 0x86, 0x70, 0x0F, 0x00, 0xE0, 0x0E, 0x00, 0xE1,
+  0xFE, 0x1F, 0xE1, 0xFE, 0x07, 0xF0, 0x77, 0x07, 0x78, 0x73, 0xFF, 0x1F,
+  0xF0, 0xFC, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07,
+  0xE0, 0xFC, 0x1C, 0xFF, 0xFF, 0xFF, 0xE3, 0x81, 0xC0, 0xE0, 0x70, 0x38,
+  0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x71, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x0F, 0xE1, 0xFC, 0x3F, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
+  0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0F, 0x01, 0xF0, 0x7F, 0xFE, 0xFF, 0xCF,
+  0xE0, 0xE0, 0xF7, 0x0F, 0x38, 0x71, 0xC7, 0x8E, 0x78, 0x77, 0x83, 0xF8,
+  0x1F, 0xC0, 0xFF, 0x07, 0xF8, 0x3D, 0xE1, 0xCF, 0x0E, 0x3C, 0x71, 0xE3,
+  0x87, 0x9C, 0x3C, 0xE0, 0xF7, 0x07, 0x80, 0xE0, 0x1C, 0x03, 0x80, 0x70,
+  0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E,
+  0x01, 0xC0, 0x38, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xFF, 0x0F, 0xF9,
+  0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xEF, 0x7E, 0xF7, 0xEF, 0x7E, 0xF7, 0xEF,
+  0x7E, 0x67, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xF0,
+  0xFE, 0x1F, 0xC3, 0xFC, 0x7F, 0x8F, 0xF1, 0xFB, 0x3F, 0x67, 0xEC, 0xFC,
+  0xDF, 0x9B, 0xF3, 0x7E, 0x3F, 0xC7, 0xF8, 0xFF, 0x0F, 0xE1, 0xFC, 0x3C,
+  0x0F, 0x03, 0xFC, 0x7F, 0xE7, 0x0E, 0x70, 0xEE, 0x07, 0xE0, 0x7E, 0x07,
+  0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x77, 0x0E, 0x70, 0xE7, 0xFE,
+  0x3F, 0xC0, 0xF0, 0xFF, 0x1F, 0xFB, 0xFF, 0x70, 0xFE, 0x0F, 0xC1, 0xF8,
+  0x3F, 0x0F, 0xFF, 0xDF, 0xFB, 0xFC, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07,
+  0x00, 0xE0, 0x1C, 0x00, 0x0F, 0x03, 0xFC, 0x7F, 0xE7, 0x0E, 0x70, 0xEE,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x77,
+  0x0F, 0x70, 0xE7, 0xFE, 0x3F, 0xC0, 0xFC, 0x01, 0xE0, 0x0E, 0x00, 0x40,
+  0xFF, 0x07, 0xFE, 0x3F, 0xF1, 0xC3, 0xCE, 0x0E, 0x70, 0x73, 0x83, 0x9C,
+  0x3C, 0xFF, 0xC7, 0xF8, 0x3F, 0xE1, 0xC7, 0x8E, 0x3C, 0x70, 0xF3, 0x87,
+  0x9C, 0x1E, 0xE0, 0xF7, 0x03, 0xC0, 0x1F, 0x8F, 0xF9, 0xFF, 0x78, 0x6E,
+  0x05, 0xC0, 0x3C, 0x03, 0xF0, 0x7F, 0x83, 0xF8, 0x1F, 0x80, 0xF0, 0x0F,
+  0x01, 0xF8, 0x7F, 0xFE, 0xFF, 0xCF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x87,
+  0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00,
+  0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0xE0, 0xFC, 0x1F, 0x83,
+  0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0,
+  0x7E, 0x0F, 0xC1, 0xFC, 0x7B, 0xFE, 0x7F, 0xC3, 0xE0, 0xF0, 0x7F, 0x83,
+  0xDC, 0x1C, 0xE0, 0xE7, 0x07, 0x3C, 0x79, 0xE3, 0xC7, 0x1C, 0x38, 0xE1,
+  0xC7, 0x0F, 0x78, 0x3B, 0x81, 0xDC, 0x0E, 0xE0, 0x77, 0x01, 0xF0, 0x0F,
+  0x80, 0x7C, 0x00, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0x60, 0x1D,
+  0xDE, 0x67, 0x7B, 0x9D, 0xEE, 0x77, 0xB9, 0xDE, 0xE7, 0x7F, 0x9F, 0x3E,
+  0x7C, 0xF8, 0xF3, 0xE3, 0xCF, 0x0F, 0x3C, 0x38, 0x70, 0xE1, 0xC0, 0xF0,
+  0x3D, 0xC0, 0xE7, 0x87, 0x8F, 0x3C, 0x1C, 0xE0, 0x7F, 0x80, 0xFC, 0x03,
+  0xF0, 0x07, 0x80, 0x1E, 0x00, 0xFC, 0x03, 0xF0, 0x1F, 0xE0, 0x73, 0x83,
+  0xCF, 0x1E, 0x1E, 0x70, 0x3B, 0xC0, 0xF0, 0xF0, 0x7B, 0x83, 0x9E, 0x3C,
+  0x71, 0xC3, 0xDE, 0x0E, 0xE0, 0x77, 0x03, 0xF8, 0x0F, 0x80, 0x7C, 0x01,
+  0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x01, 0xE0, 0x3C, 0x03, 0xC0,
+  0x78, 0x0F, 0x00, 0xF0, 0x1E, 0x03, 0xC0, 0x3C, 0x07, 0x80, 0xF0, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E,
+  0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x3F, 0xFC, 0xE0, 0x06, 0x00, 0x70,
+  0x03, 0x00, 0x38, 0x01, 0x80, 0x1C, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x07,
+  0x00, 0x70, 0x03, 0x80, 0x38, 0x01, 0x80, 0x1C, 0x00, 0xC0, 0x0E, 0x00,
+  0x60, 0x07, 0xFF, 0xF1, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
+  0x71, 0xC7, 0x1C, 0x71, 0xFF, 0xFC, 0x07, 0x00, 0x7C, 0x07, 0xF0, 0x3B,
+  0x83, 0x8E, 0x38, 0x3B, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0xF0, 0x70, 0x70,
+  0x70, 0x70, 0x3F, 0x87, 0xFE, 0x7F, 0xE6, 0x0F, 0x00, 0x73, 0xFF, 0x7F,
+  0xFF, 0xFF, 0xE0, 0x7E, 0x0F, 0xFF, 0xF7, 0xFF, 0x3E, 0x70, 0xE0, 0x0E,
+  0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x78, 0xEF, 0xCF, 0xFE, 0xF0, 0xFE,
+  0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xF0, 0xFF, 0xFE, 0xEF, 0xCE,
+  0x78, 0x0F, 0xC7, 0xFD, 0xFF, 0xBC, 0x1F, 0x01, 0xC0, 0x38, 0x07, 0x00,
+  0xF0, 0x0F, 0x05, 0xFF, 0x9F, 0xF0, 0xFC, 0x00, 0x70, 0x07, 0x00, 0x70,
+  0x07, 0x00, 0x71, 0xE7, 0x3F, 0x77, 0xFF, 0xF0, 0xFE, 0x07, 0xE0, 0x7E,
+  0x07, 0xE0, 0x7E, 0x07, 0xF0, 0xF7, 0xFF, 0x3F, 0x71, 0xE7, 0x1F, 0x83,
+  0xFC, 0x7F, 0xE7, 0x0F, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
+  0x02, 0x7F, 0xE3, 0xFE, 0x1F, 0xC0, 0x0F, 0xC7, 0xF1, 0xFC, 0x70, 0x1C,
+  0x3F, 0xFF, 0xFF, 0xFF, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01,
+  0xC0, 0x70, 0x1C, 0x07, 0x00, 0x1E, 0x73, 0xFF, 0x7F, 0xFF, 0x0F, 0xE0,
+  0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x0F, 0x7F, 0xF3, 0xFF, 0x1F,
+  0x70, 0x07, 0x40, 0xF7, 0xFE, 0x7F, 0xE3, 0xF8, 0xE0, 0x1C, 0x03, 0x80,
+  0x70, 0x0E, 0x01, 0xCF, 0x3F, 0xF7, 0xFF, 0xF1, 0xFC, 0x1F, 0x83, 0xF0,
+  0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1C, 0x0E, 0x01, 0xC0,
+  0x38, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x7E, 0x0F, 0xC0, 0x38,
+  0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0xFF,
+  0xFE, 0xFC, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x1E, 0xE3,
+  0xCE, 0x78, 0xEF, 0x0F, 0xE0, 0xFE, 0x0F, 0xF0, 0xF7, 0x0E, 0x78, 0xE3,
+  0xCE, 0x1C, 0xE1, 0xEE, 0x0F, 0xFC, 0x1F, 0x83, 0xF0, 0x0E, 0x01, 0xC0,
+  0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38,
+  0x07, 0x80, 0xFF, 0x0F, 0xE0, 0xFC, 0xEE, 0xF7, 0xF7, 0xBF, 0xFF, 0xCE,
+  0x7E, 0x73, 0xF3, 0x9F, 0x9C, 0xFC, 0xE7, 0xE7, 0x3F, 0x39, 0xF9, 0xCF,
+  0xCE, 0x7E, 0x73, 0x80, 0xE7, 0x9F, 0xFB, 0xFF, 0xF8, 0xFE, 0x0F, 0xC1,
+  0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0E, 0x1F, 0x83,
+  0xFC, 0x7F, 0xEF, 0x0E, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x77,
+  0x0E, 0x7F, 0xE3, 0xFC, 0x1F, 0x80, 0xE7, 0x8E, 0xFC, 0xFF, 0xEF, 0x0F,
+  0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x0F, 0xFF, 0xEE, 0xFC,
+  0xE7, 0x8E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x1E, 0x73, 0xF7,
+  0x7F, 0xFF, 0x0F, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0xE0, 0x7F, 0x0F,
+  0x7F, 0xF3, 0xF7, 0x1E, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07,
+  0xE7, 0xBB, 0xFF, 0xFF, 0xE1, 0xF0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38,
+  0x0E, 0x03, 0x80, 0xE0, 0x00, 0x3F, 0x8F, 0xFB, 0xFF, 0x70, 0x2F, 0x81,
+  0xFF, 0x1F, 0xF0, 0x7F, 0x00, 0xF8, 0x1F, 0xFF, 0xFF, 0xE3, 0xF8, 0x1C,
+  0x07, 0x01, 0xC0, 0x70, 0xFF, 0xFF, 0xFF, 0xFC, 0x70, 0x1C, 0x07, 0x01,
+  0xC0, 0x70, 0x1C, 0x07, 0x01, 0xFC, 0x3F, 0x07, 0xC0, 0xE0, 0xFC, 0x1F,
+  0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFE, 0x3F, 0xFF,
+  0xBF, 0xF3, 0xCE, 0xF0, 0xFF, 0x0F, 0x70, 0xE7, 0x0E, 0x79, 0xE3, 0x9C,
+  0x39, 0xC3, 0x9C, 0x1F, 0x81, 0xF8, 0x1F, 0x80, 0xF0, 0x0F, 0x00, 0xE0,
+  0x1F, 0x80, 0x7E, 0x01, 0xD8, 0xC6, 0x77, 0xB9, 0xDE, 0xE7, 0x7B, 0x9D,
+  0xEE, 0x34, 0xB0, 0xF3, 0xC3, 0xCF, 0x0F, 0x3C, 0x3C, 0xF0, 0xF0, 0xF7,
+  0x9E, 0x39, 0xC3, 0xFC, 0x1F, 0x80, 0xF0, 0x0F, 0x01, 0xF8, 0x1F, 0x83,
+  0xFC, 0x39, 0xC7, 0x9E, 0xF0, 0xF0, 0xF0, 0xF7, 0x0E, 0x70, 0xE7, 0x9E,
+  0x39, 0xC3, 0x9C, 0x3D, 0xC1, 0xF8, 0x1F, 0x80, 0xF8, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xE0, 0x1E, 0x07, 0xE0, 0x7C, 0x07, 0x80, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x07, 0xC3, 0xF0, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0,
+  0x38, 0x0E, 0x07, 0x8F, 0xC3, 0xF0, 0x1E, 0x03, 0x80, 0xE0, 0x38, 0x0E,
+  0x03, 0x80, 0xE0, 0x38, 0x0F, 0xC1, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01,
+  0xC0, 0x70, 0x1C, 0x07, 0x80, 0xFC, 0x3F, 0x1E, 0x07, 0x01, 0xC0, 0x70,
+  0x1C, 0x07, 0x01, 0xC0, 0x70, 0xFC, 0x3E, 0x00, 0x7C, 0x1F, 0xFF, 0xFF,
+  0xF8, 0x3E };
+
+const GFXglyph FreeMonoBold12pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  14,    0,    0 },   // 0x20 ' '
+  {     1,   3,  18,  14,    6,  -17 },   // 0x21 '!'
+  {     8,   9,   7,  14,    3,  -17 },   // 0x22 '"'
+  {    16,  14,  17,  14,    0,  -16 },   // 0x23 '#'
+  {    46,  12,  22,  14,    1,  -17 },   // 0x24 '$'
+  {    79,  14,  18,  14,    0,  -17 },   // 0x25 '%'
+  {   111,  14,  18,  14,    1,  -17 },   // 0x26 '&'
+  {   143,   3,   7,  14,    6,  -17 },   // 0x27 '''
+  {   146,   6,  21,  14,    4,  -17 },   // 0x28 '('
+  {   162,   6,  21,  14,    4,  -17 },   // 0x29 ')'
+  {   178,  12,  12,  14,    1,  -17 },   // 0x2A '*'
+  {   196,  13,  13,  14,    1,  -13 },   // 0x2B '+'
+  {   218,   5,   8,  14,    4,   -3 },   // 0x2C ','
+  {   223,   7,   3,  14,    4,   -7 },   // 0x2D '-'
+  {   226,   4,   4,  14,    5,   -3 },   // 0x2E '.'
+  {   228,  12,  20,  14,    1,  -17 },   // 0x2F '/'
+  {   258,  12,  18,  14,    1,  -17 },   // 0x30 '0'
+  {   285,  11,  18,  14,    2,  -17 },   // 0x31 '1'
+  {   310,  12,  18,  14,    1,  -17 },   // 0x32 '2'
+  {   337,  12,  18,  14,    1,  -17 },   // 0x33 '3'
+  {   364,  12,  18,  14,    1,  -17 },   // 0x34 '4'
+  {   391,  12,  18,  14,    1,  -17 },   // 0x35 '5'
+  {   418,  12,  18,  14,    1,  -17 },   // 0x36 '6'
+  {   445,  12,  18,  14,    1,  -17 },   // 0x37 '7'
+  {   472,  12,  18,  14,    1,  -17 },   // 0x38 '8'
+  {   499,  12,  18,  14,    1,  -17 },   // 0x39 '9'
+  {   526,   4,  12,  14,    5,  -11 },   // 0x3A ':'
+  {   532,   5,  16,  14,    4,  -11 },   // 0x3B ';'
+  {   542,  12,  13,  14,    1,  -13 },   // 0x3C '<'
+  {   562,  12,   9,  14,    1,  -11 },   // 0x3D '='
+  {   576,  12,  13,  14,    1,  -13 },   // 0x3E '>'
+  {   596,  10,  18,  14,    3,  -17 },   // 0x3F '?'
+  {   619,  14,  20,  14,    0,  -15 },   // 0x40 '@'
+  {   654,  14,  18,  14,    0,  -17 },   // 0x41 'A'
+  {   686,  12,  18,  14,    1,  -17 },   // 0x42 'B'
+  {   713,  11,  18,  14,    2,  -17 },   // 0x43 'C'
+  {   738,  12,  18,  14,    2,  -17 },   // 0x44 'D'
+  {   765,  11,  18,  14,    2,  -17 },   // 0x45 'E'
+  {   790,  11,  18,  14,    2,  -17 },   // 0x46 'F'
+  {   815,  12,  18,  14,    1,  -17 },   // 0x47 'G'
+  {   842,  11,  18,  14,    2,  -17 },   // 0x48 'H'
+  {   867,   9,  18,  14,    3,  -17 },   // 0x49 'I'
+  {   888,  11,  18,  14,    1,  -17 },   // 0x4A 'J'
+  {   913,  13,  18,  14,    1,  -17 },   // 0x4B 'K'
+  {   943,  11,  18,  14,    3,  -17 },   // 0x4C 'L'
+  {   968,  12,  18,  14,    1,  -17 },   // 0x4D 'M'
+  {   995,  11,  18,  14,    1,  -17 },   // 0x4E 'N'
+  {  1020,  12,  18,  14,    1,  -17 },   // 0x4F 'O'
+  {  1047,  11,  18,  14,    2,  -17 },   // 0x50 'P'
+  {  1072,  12,  21,  14,    1,  -17 },   // 0x51 'Q'
+  {  1104,  13,  18,  14,    2,  -17 },   // 0x52 'R'
+  {  1134,  11,  18,  14,    2,  -17 },   // 0x53 'S'
+  {  1159,  11,  18,  14,    2,  -17 },   // 0x54 'T'
+  {  1184,  11,  18,  14,    1,  -17 },   // 0x55 'U'
+  {  1209,  13,  18,  14,    1,  -17 },   // 0x56 'V'
+  {  1239,  14,  18,  14,    0,  -17 },   // 0x57 'W'
+  {  1271,  14,  18,  14,    0,  -17 },   // 0x58 'X'
+  {  1303,  13,  18,  14,    1,  -17 },   // 0x59 'Y'
+  {  1333,  12,  18,  14,    1,  -17 },   // 0x5A 'Z'
+  {  1360,   6,  21,  14,    5,  -17 },   // 0x5B '['
+  {  1376,  12,  20,  14,    1,  -17 },   // 0x5C '\'
+  {  1406,   6,  21,  14,    3,  -17 },   // 0x5D ']'
+  {  1422,  13,   7,  14,    1,  -17 },   // 0x5E '^'
+  {  1434,  14,   2,  14,    0,    5 },   // 0x5F '_'
+  {  1438,   7,   4,  14,    2,  -18 },   // 0x60 '`'
+  {  1442,  12,  13,  14,    1,  -12 },   // 0x61 'a'
+  {  1462,  12,  18,  14,    1,  -17 },   // 0x62 'b'
+  {  1489,  11,  13,  14,    2,  -12 },   // 0x63 'c'
+  {  1507,  12,  18,  14,    1,  -17 },   // 0x64 'd'
+  {  1534,  12,  13,  14,    1,  -12 },   // 0x65 'e'
+  {  1554,  10,  18,  14,    2,  -17 },   // 0x66 'f'
+  {  1577,  12,  18,  14,    1,  -12 },   // 0x67 'g'
+  {  1604,  11,  18,  14,    2,  -17 },   // 0x68 'h'
+  {  1629,  11,  20,  14,    2,  -19 },   // 0x69 'i'
+  {  1657,   8,  25,  14,    2,  -19 },   // 0x6A 'j'
+  {  1682,  12,  18,  14,    2,  -17 },   // 0x6B 'k'
+  {  1709,  11,  18,  14,    2,  -17 },   // 0x6C 'l'
+  {  1734,  13,  13,  14,    1,  -12 },   // 0x6D 'm'
+  {  1756,  11,  13,  14,    2,  -12 },   // 0x6E 'n'
+  {  1774,  12,  13,  14,    1,  -12 },   // 0x6F 'o'
+  {  1794,  12,  18,  14,    1,  -12 },   // 0x70 'p'
+  {  1821,  12,  18,  14,    1,  -12 },   // 0x71 'q'
+  {  1848,  10,  13,  14,    3,  -12 },   // 0x72 'r'
+  {  1865,  11,  13,  14,    2,  -12 },   // 0x73 's'
+  {  1883,  10,  17,  14,    2,  -16 },   // 0x74 't'
+  {  1905,  11,  13,  14,    2,  -12 },   // 0x75 'u'
+  {  1923,  12,  13,  14,    1,  -12 },   // 0x76 'v'
+  {  1943,  14,  13,  14,    0,  -12 },   // 0x77 'w'
+  {  1966,  12,  13,  14,    1,  -12 },   // 0x78 'x'
+  {  1986,  12,  18,  14,    1,  -12 },   // 0x79 'y'
+  {  2013,  11,  13,  14,    1,  -12 },   // 0x7A 'z'
+  {  2031,  10,  22,  14,    2,  -17 },   // 0x7B '{'
+  {  2059,   3,  24,  14,    6,  -17 },   // 0x7C '|'
+  {  2068,  10,  22,  14,    3,  -17 },   // 0x7D '}'
+  {  2096,  12,   4,  14,    1,   -9 }    // 0x7E '~'
+};
+
+const GFXfont FreeMonoBold12pt7b PROGMEM = {
+  (uint8_t  *)FreeMonoBold12pt7bBitmaps,
+  (GFXglyph *)FreeMonoBold12pt7bGlyphs,
+  0x20, 0x7E, 24 };
+
+#endif // FREEMONOBOLD12PT7B_H
@@ -0,0 +1,6 @@
+#ifndef SPI_H
+#define SPI_H
+
+// The simulator's display isn't behind a bus, see TFT_eSPI.h
+
+#endif // SPI_H
@@ -0,0 +1,21 @@
+#ifndef SPIFFS_H
+#define SPIFFS_H
+
+#include "FS.h"
+
+namespace fs
+{
+
+// Always mounted; format() empties it
+class SPIFFSFS : public FS
+{
+public:
+  bool begin(bool formatOnFail = false) { return true; }
+  bool format();
+};
+
+} // namespace fs
+
+extern fs::SPIFFSFS SPIFFS;
+
+#endif // SPIFFS_H
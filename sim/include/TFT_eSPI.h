@@ -0,0 +1,204 @@
+#ifndef TFT_ESPI_H
+#define TFT_ESPI_H
+
+// Host stand-in for the TFT_eSPI API the dash uses, drawing into a
+// framebuffer in memory. Shapes and text are built from the same virtual
+// primitives, in the same order, as the library builds them, so a
+// CountingTFT counts what it would on the panel. Every window sent to the
+// panel moves virtual time on by what it takes at SPI_FREQUENCY.
+//
+// Built in fonts only appear on the calibration, diagnostics and update
+// screens. They're drawn with the FreeMono9pt7b stand-in in fixed cells,
+// so those screens are legible but not pixel exact.
+
+#include <Arduino.h>
+#include "FS.h"
+#include "SPIFFS.h"
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 320
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 480
+#endif
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_MAROON      0x7800
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define CL_DATUM 3
+#define MC_DATUM 4
+#define CC_DATUM 4
+#define MR_DATUM 5
+#define CR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+#define L_BASELINE 9
+#define C_BASELINE 10
+#define R_BASELINE 11
+
+typedef struct
+{
+  uint32_t bitmapOffset;
+  uint8_t width, height;
+  uint8_t xAdvance;
+  int8_t xOffset, yOffset;
+} GFXglyph;
+
+typedef struct
+{
+  uint8_t *bitmap;
+  GFXglyph *glyph;
+  uint16_t first, last;
+  uint8_t yAdvance;
+} GFXfont;
+
+#include "Fonts/FreeMono9pt7b.h"
+#include "Fonts/FreeMonoBold12pt7b.h"
+
+class TFT_eSPI : public Print
+{
+public:
+  TFT_eSPI(int16_t _W = TFT_WIDTH, int16_t _H = TFT_HEIGHT);
+  virtual ~TFT_eSPI();
+
+  void init(uint8_t tc = 0);
+  void setRotation(uint8_t r);
+  uint8_t getRotation() { return rotation; }
+  int16_t width() { return _vpDatum ? _xWidth : _width; }
+  int16_t height() { return _vpDatum ? _yHeight : _height; }
+
+  virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+  virtual void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  virtual void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+
+  void fillScreen(uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color);
+  void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t radius, uint32_t color);
+
+  void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+  void resetViewport();
+
+  // Without DMA, pushes block until sent; ESP32_DMA is never defined here
+  void startWrite() {}
+  void endWrite() {}
+  void setSwapBytes(bool swap) { _swapBytes = swap; }
+  bool getSwapBytes() { return _swapBytes; }
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+
+  void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+  int16_t getCursorX() { return cursor_x; }
+  int16_t getCursorY() { return cursor_y; }
+  void setTextColor(uint16_t color) { textcolor = textbgcolor = color; }
+  void setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill = false);
+  void setTextSize(uint8_t size) { textsize = size > 0 ? size : 1; }
+  void setTextDatum(uint8_t datum) { textdatum = datum; }
+  uint8_t getTextDatum() { return textdatum; }
+  void setTextPadding(uint16_t x_width) { padX = x_width; }
+  uint16_t getTextPadding() { return padX; }
+  void setTextFont(uint8_t font);
+  void setFreeFont(const GFXfont *f = nullptr);
+
+  int16_t textWidth(const char *string, uint8_t font);
+  int16_t textWidth(const char *string) { return textWidth(string, textfont); }
+  int16_t textWidth(const String &string) { return textWidth(string.c_str(), textfont); }
+  int16_t fontHeight(uint8_t font);
+  int16_t fontHeight() { return fontHeight(textfont); }
+
+  int16_t drawString(const char *string, int32_t x, int32_t y, uint8_t font);
+  int16_t drawString(const char *string, int32_t x, int32_t y) { return drawString(string, x, y, textfont); }
+  int16_t drawString(const String &string, int32_t x, int32_t y) { return drawString(string.c_str(), x, y, textfont); }
+  int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font);
+  int16_t drawChar(uint16_t uniCode, int32_t x, int32_t y) { return drawChar(uniCode, x, y, textfont); }
+  void drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size);
+
+  size_t write(uint8_t c) override;
+
+  // Touches come from simSetTouch(); calibration is taken as given
+  bool getTouch(uint16_t *x, uint16_t *y, uint16_t threshold = 600);
+  void calibrateTouch(uint16_t *data, uint32_t color_fg, uint32_t color_bg, uint8_t size);
+  void setTouch(uint16_t *data);
+
+  // Host only: the panel as width() x height() RGB565 pixels
+  const uint16_t *frameBuffer() const { return _frame; }
+
+  uint8_t textfont = 1;
+  uint8_t textsize = 1;
+  uint8_t textdatum = TL_DATUM;
+  uint32_t textcolor = TFT_WHITE;
+  uint32_t textbgcolor = TFT_BLACK;
+  int32_t cursor_x = 0;
+  int32_t cursor_y = 0;
+  uint32_t padX = 0;
+
+protected:
+  int32_t _init_width, _init_height;
+  int32_t _width, _height;
+  uint8_t rotation = 0;
+
+  // As in the library: _vpW and _vpH are the right and bottom edges + 1
+  int32_t _vpX, _vpY, _vpW, _vpH;
+  int32_t _xDatum, _yDatum;
+  int32_t _xWidth, _yHeight;
+  bool _vpDatum, _vpOoB;
+
+  GFXfont *gfxFont = nullptr;
+  uint8_t glyph_ab = 0; // Tallest glyph above the baseline
+  uint8_t glyph_bb = 0; // Deepest glyph below it
+  bool _swapBytes = false;
+
+  // Clip a rect to the viewport, in screen coordinates. False if nothing's left.
+  bool clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h);
+
+  // Send an already clipped window of one colour, or of pixels when
+  // pixels isn't null. The sprite writes to its own memory instead.
+  virtual void writeWindow(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color, const uint16_t *pixels = nullptr);
+
+private:
+  uint16_t *_frame = nullptr;
+
+  void drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color);
+  void fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color);
+  void drawBuiltinChar(int32_t x, int32_t y, uint16_t c);
+};
+
+// 16 bit sprites only, pixels stored byte swapped as the library does
+class TFT_eSprite : public TFT_eSPI
+{
+public:
+  explicit TFT_eSprite(TFT_eSPI *tft);
+  ~TFT_eSprite() override;
+
+  void setColorDepth(int8_t bpp) {}
+  void *createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() { return _img != nullptr; }
+  void *getPointer() { return _img; }
+  void fillSprite(uint32_t color);
+
+protected:
+  void writeWindow(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color, const uint16_t *pixels = nullptr) override;
+
+private:
+  uint16_t *_img = nullptr;
+};
+
+#endif // TFT_ESPI_H
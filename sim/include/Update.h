@@ -0,0 +1,6 @@
+#ifndef UPDATE_H
+#define UPDATE_H
+
+// Pulled in by webpage.h; the simulator doesn't serve the webpage
+
+#endif // UPDATE_H
@@ -0,0 +1,6 @@
+#ifndef WEBSERVER_H
+#define WEBSERVER_H
+
+// Pulled in by webpage.h; the simulator doesn't serve the webpage
+
+#endif // WEBSERVER_H
@@ -0,0 +1,6 @@
+#ifndef WIFI_H
+#define WIFI_H
+
+// Pulled in by webpage.h; the simulator doesn't serve the webpage
+
+#endif // WIFI_H
@@ -0,0 +1,12 @@
+#ifndef DRIVER_GPIO_H
+#define DRIVER_GPIO_H
+
+// Only named by the pins in config.h; the simulator has no GPIO
+typedef enum {
+  GPIO_NUM_2 = 2,
+  GPIO_NUM_3 = 3,
+  GPIO_NUM_13 = 13,
+  GPIO_NUM_33 = 33,
+} gpio_num_t;
+
+#endif // DRIVER_GPIO_H
@@ -0,0 +1,6 @@
+#ifndef ESP_INTR_ALLOC_H
+#define ESP_INTR_ALLOC_H
+
+// Included by haltech_can.cpp, which uses nothing from it on the host
+
+#endif // ESP_INTR_ALLOC_H
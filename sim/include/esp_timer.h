@@ -0,0 +1,9 @@
+#ifndef ESP_TIMER_H
+#define ESP_TIMER_H
+
+#include <stdint.h>
+
+// Microseconds of virtual time since the simulator started
+int64_t esp_timer_get_time();
+
+#endif // ESP_TIMER_H
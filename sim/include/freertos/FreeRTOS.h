@@ -0,0 +1,41 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+// Host stand-in for the FreeRTOS types and macros the CAN task uses. Ticks
+// are milliseconds, as configured for the ESP32.
+
+#include <stdint.h>
+#include <atomic>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFUL
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+// A spinlock, as on the ESP32
+struct portMUX_TYPE
+{
+  std::atomic<bool> locked;
+};
+
+#define portMUX_INITIALIZER_UNLOCKED {false}
+
+inline void portENTER_CRITICAL(portMUX_TYPE *mux)
+{
+  while (mux->locked.exchange(true, std::memory_order_acquire)) {
+  }
+}
+
+inline void portEXIT_CRITICAL(portMUX_TYPE *mux)
+{
+  mux->locked.store(false, std::memory_order_release);
+}
+
+#endif // FREERTOS_H
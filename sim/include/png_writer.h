@@ -0,0 +1,10 @@
+#ifndef PNG_WRITER_H
+#define PNG_WRITER_H
+
+#include <stdint.h>
+
+// Save RGB565 pixels as an 8 bit RGB PNG. Uncompressed, so it needs no
+// zlib; the files are only looked at and diffed.
+bool writePng(const char *path, const uint16_t *pixels, uint16_t width, uint16_t height);
+
+#endif // PNG_WRITER_H
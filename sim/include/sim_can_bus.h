@@ -0,0 +1,48 @@
+#ifndef SIM_CAN_BUS_H
+#define SIM_CAN_BUS_H
+
+#include "can_transport.h"
+#include "can_log.h"
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+// The bus as recorded in a candump or ASC log, played against virtual
+// time. The CAN task runs in step with the simulator's main loop: each
+// step() lets it out of waitForFrames() for one pass, in which it receives
+// the frames due by then and sends whatever it has queued, and waits for
+// it to come back. Only one of the two threads runs at a time, so a run
+// always decodes and draws the same.
+class SimCanBus : public CanTransport
+{
+public:
+  bool load(const char *path);
+  void start(uint64_t startNs); // Virtual time the log's first frame is due
+  void step();                  // Main loop only
+  bool finished() const { return _next >= _frames.size(); }
+  uint64_t endNs() const;       // When the last frame is due
+  uint32_t framesSent() const { return _framesSent; }
+
+  bool begin(long bitrate, const CanAcceptanceFilter &filter, const uint16_t *ids, uint16_t idCount) override;
+  bool waitForFrames(uint32_t timeoutMs) override;
+  bool receive(CanFrame &frame) override;
+  bool send(const CanFrame &frame, uint32_t timeoutMs) override;
+  void clearReceiveQueue() override;
+  bool getStatus(CanTransportStatus &status) override;
+
+private:
+  std::vector<CanLogFrame> _frames;
+  size_t _next = 0;
+  uint64_t _startNs = 0;
+  bool _started = false;
+  uint32_t _framesSent = 0;
+  int64_t _lastTxDoneUs = 0;
+
+  std::mutex _turnLock;
+  std::condition_variable _turnChanged;
+  bool _canTaskRunning = true; // Until it first waits for frames
+
+  bool frameDue() const;
+};
+
+#endif // SIM_CAN_BUS_H
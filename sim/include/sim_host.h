@@ -0,0 +1,26 @@
+#ifndef SIM_HOST_H
+#define SIM_HOST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Controls for the host stand-ins, used by the simulator itself
+
+// Virtual time. Only delay(), traffic to the display and the simulator's
+// main loop move it on, so a run gives the same result on any machine.
+uint64_t simNowNs();
+void simAdvanceNs(uint64_t ns);
+void simAdvanceTo(uint64_t ns); // Nothing if already past it
+
+// Real time instead, for a real bus. Advancing sleeps rather than jumps.
+void simUseWallClock();
+bool simOnWallClock();
+
+// What TFT_eSPI::getTouch() reports, in screen coordinates
+void simSetTouch(bool pressed, uint16_t x, uint16_t y);
+
+// In-memory SPIFFS contents. Writes made while running stay in memory.
+void simFsPut(const char *path, const uint8_t *data, size_t size);
+bool simFsLoadDir(const char *hostDir); // Each file in hostDir as /<name>
+
+#endif // SIM_HOST_H
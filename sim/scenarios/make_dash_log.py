@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+# Writes dash.log: ten seconds of a Haltech ECU on a pull up to 6500 rpm
+# and back, in candump -l format, for the signals on the default layout
+# and one ID the dash doesn't know. Everything stays inside the default
+# alert limits.
+import math
+import sys
+
+DURATION_S = 10.0
+EPOCH = 1700000000.0
+
+
+def u16(value):
+    value = int(round(value)) & 0xFFFF
+    return [value >> 8, value & 0xFF]
+
+
+def u32(value):
+    value = int(round(value)) & 0xFFFFFFFF
+    return [value >> 24, (value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF]
+
+
+def load(t):
+    """0 at idle, 1 at the top of the pull."""
+    return math.sin(math.pi * t / DURATION_S) ** 2
+
+
+# (CAN ID, period ms, payload at time t), scaled as haltech_signals.def decodes them
+FRAMES = [
+    (0x360, 20, lambda t: u16(900 + 5600 * load(t)) + u16(10 * (35 + 140 * load(t))) + u16(10 * 100 * load(t)) + [0, 0]),
+    (0x361, 50, lambda t: [0, 0] + u16(10 * (101.3 + 200 + 250 * load(t))) + [0, 0, 0, 0]),
+    (0x362, 50, lambda t: [0, 0, 0, 0] + u16(10 * (12 + 20 * load(t))) + [0, 0]),
+    (0x36A, 20, lambda t: u16(100 * 2 * load(t) * (1 + math.sin(7 * t)) / 2) + [0] * 6),
+    (0x36F, 20, lambda t: [0, 0] + u16(10 * 60 * load(t)) + [0, 0, 0, 0]),
+    (0x370, 20, lambda t: u16(10 * 90 * load(t)) + [0, 0] + u16(10 * 25 * load(t)) + [0, 0]),
+    (0x372, 100, lambda t: u16(10 * (13.9 + 0.2 * load(t))) + [0, 0] + u16(10 * 180) + [0, 0]),
+    (0x3E0, 200, lambda t: u16(10 * (362 + 2 * t / DURATION_S)) + u16(10 * 303) + [0, 0] + u16(10 * (370 + t / DURATION_S))),
+    (0x470, 20, lambda t: u16(1000 * (1.0 - 0.15 * load(t))) + [0] * 6),
+    (0x473, 100, lambda t: u32(12000 + 40 * t) + [0] * 4),
+    # Not a Haltech ID, for the diagnostics screen's unknown ID list
+    (0x7A0, 100, lambda t: [0x12, 0x34, int(t * 10) & 0xFF, 0, 0, 0, 0, 0]),
+]
+
+
+def main(path):
+    events = []
+    for canId, periodMs, payload in FRAMES:
+        # Spread the IDs within their period as an ECU does
+        for ms in range(canId % periodMs, int(DURATION_S * 1000), periodMs):
+            events.append((ms, canId, payload(ms / 1000.0)))
+    events.sort(key=lambda event: event[0])
+
+    with open(path, "w") as out:
+        out.write("# Written by make_dash_log.py\n")
+        for ms, canId, data in events:
+            out.write("(%.6f) can0 %03X#%s\n" % (EPOCH + ms / 1000.0, canId, "".join("%02X" % b for b in data)))
+
+
+if __name__ == "__main__":
+    main(sys.argv[1] if len(sys.argv) > 1 else "dash.log")
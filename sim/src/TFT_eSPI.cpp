@@ -0,0 +1,664 @@
+#include "TFT_eSPI.h"
+#include "panel_traffic.h"
+#include "sim_host.h"
+
+// Cell the built in fonts are drawn in
+#define BUILTIN_CHAR_WIDTH 11
+#define BUILTIN_CHAR_HEIGHT 16
+
+static bool touchPressed = false;
+static uint16_t touchX = 0;
+static uint16_t touchY = 0;
+
+void simSetTouch(bool pressed, uint16_t x, uint16_t y)
+{
+  touchPressed = pressed;
+  touchX = x;
+  touchY = y;
+}
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+    : _init_width(w), _init_height(h), _width(w), _height(h)
+{
+  resetViewport();
+}
+
+TFT_eSPI::~TFT_eSPI()
+{
+  delete[] _frame;
+}
+
+void TFT_eSPI::init(uint8_t tc)
+{
+  if (_frame == nullptr) {
+    _frame = new uint16_t[_init_width * _init_height];
+  }
+  memset(_frame, 0, _init_width * _init_height * sizeof(uint16_t));
+  setRotation(0);
+}
+
+void TFT_eSPI::setRotation(uint8_t r)
+{
+  rotation = r % 4;
+  _width = rotation & 1 ? _init_height : _init_width;
+  _height = rotation & 1 ? _init_width : _init_height;
+  resetViewport();
+}
+
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum)
+{
+  _xDatum = x;
+  _yDatum = y;
+  _xWidth = w;
+  _yHeight = h;
+
+  _vpDatum = false;
+  _vpOoB = false;
+  _vpX = 0;
+  _vpY = 0;
+  _vpW = _width;
+  _vpH = _height;
+
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > _width) { w = _width - x; }
+  if (y + h > _height) { h = _height - y; }
+
+  if (w < 1 || h < 1) {
+    _xDatum = 0;
+    _yDatum = 0;
+    _xWidth = _width;
+    _yHeight = _height;
+    _vpOoB = true;
+    return;
+  }
+
+  if (!vpDatum) {
+    _xDatum = 0;
+    _yDatum = 0;
+    _xWidth = _width;
+    _yHeight = _height;
+  }
+
+  _vpX = x;
+  _vpY = y;
+  _vpW = x + w;
+  _vpH = y + h;
+  _vpDatum = vpDatum;
+}
+
+void TFT_eSPI::resetViewport()
+{
+  _vpDatum = false;
+  _vpOoB = false;
+  _xDatum = 0;
+  _yDatum = 0;
+  _vpX = 0;
+  _vpY = 0;
+  _vpW = _width;
+  _vpH = _height;
+  _xWidth = _width;
+  _yHeight = _height;
+}
+
+bool TFT_eSPI::clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h)
+{
+  if (_vpOoB) {
+    return false;
+  }
+  x += _xDatum;
+  y += _yDatum;
+  if (x >= _vpW || y >= _vpH) {
+    return false;
+  }
+  if (x < _vpX) { w += x - _vpX; x = _vpX; }
+  if (y < _vpY) { h += y - _vpY; y = _vpY; }
+  if (x + w > _vpW) { w = _vpW - x; }
+  if (y + h > _vpH) { h = _vpH - y; }
+  return w > 0 && h > 0;
+}
+
+void TFT_eSPI::writeWindow(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color, const uint16_t *pixels)
+{
+  if (_frame == nullptr) {
+    return;
+  }
+  for (int32_t row = 0; row < h; row++) {
+    uint16_t *line = _frame + (y + row) * _width + x;
+    for (int32_t column = 0; column < w; column++) {
+      line[column] = pixels != nullptr ? pixels[row * w + column] : color;
+    }
+  }
+  uint64_t bytes = (uint64_t)w * h * PANEL_BYTES_PER_PIXEL + PANEL_WINDOW_BYTES;
+  simAdvanceNs(bytes * 8 * 1000000000ULL / SPI_FREQUENCY);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+  int32_t w = 1, h = 1;
+  if (clip(x, y, w, h)) {
+    writeWindow(x, y, w, h, color);
+  }
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+  int32_t h = 1;
+  if (clip(x, y, w, h)) {
+    writeWindow(x, y, w, h, color);
+  }
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
+{
+  int32_t w = 1;
+  if (clip(x, y, w, h)) {
+    writeWindow(x, y, w, h, color);
+  }
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  if (clip(x, y, w, h)) {
+    writeWindow(x, y, w, h, color);
+  }
+}
+
+void TFT_eSPI::fillScreen(uint32_t color)
+{
+  fillRect(0, 0, _width, _height, color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color)
+{
+  if (r <= 0) {
+    return;
+  }
+  int32_t f = 1 - r;
+  int32_t ddF_x = 1;
+  int32_t ddF_y = -2 * r;
+  int32_t xe = 0;
+  int32_t xs = 0;
+  int32_t len = 0;
+
+  while (xe < r--) {
+    while (f < 0) {
+      ++xe;
+      f += (ddF_x += 2);
+    }
+    f += (ddF_y += 2);
+
+    if (xe - xs == 1) {
+      if (cornername & 0x1) {
+        drawPixel(x0 - xe, y0 - r, color);
+        drawPixel(x0 - r, y0 - xe, color);
+      }
+      if (cornername & 0x2) {
+        drawPixel(x0 + r, y0 - xe, color);
+        drawPixel(x0 + xs + 1, y0 - r, color);
+      }
+      if (cornername & 0x4) {
+        drawPixel(x0 + xs + 1, y0 + r, color);
+        drawPixel(x0 + r, y0 + xs + 1, color);
+      }
+      if (cornername & 0x8) {
+        drawPixel(x0 - r, y0 + xs + 1, color);
+        drawPixel(x0 - xe, y0 + r, color);
+      }
+    } else {
+      len = xe - xs++;
+      if (cornername & 0x1) {
+        drawFastHLine(x0 - xe, y0 - r, len, color);
+        drawFastVLine(x0 - r, y0 - xe, len, color);
+      }
+      if (cornername & 0x2) {
+        drawFastVLine(x0 + r, y0 - xe, len, color);
+        drawFastHLine(x0 + xs, y0 - r, len, color);
+      }
+      if (cornername & 0x4) {
+        drawFastHLine(x0 + xs, y0 + r, len, color);
+        drawFastVLine(x0 + r, y0 + xs, len, color);
+      }
+      if (cornername & 0x8) {
+        drawFastVLine(x0 - r, y0 + xs, len, color);
+        drawFastHLine(x0 - xe, y0 + r, len, color);
+      }
+    }
+    xs = xe;
+  }
+}
+
+void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color)
+{
+  int32_t f = 1 - r;
+  int32_t ddF_x = 1;
+  int32_t ddF_y = -r - r;
+  int32_t y = 0;
+
+  delta++;
+
+  while (y < r) {
+    if (f >= 0) {
+      if (cornername & 0x1) drawFastHLine(x0 - r, y0 + y, r + r + delta, color);
+      if (cornername & 0x2) drawFastHLine(x0 - r, y0 - y, r + r + delta, color);
+      r--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+
+    y++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    if (cornername & 0x1) drawFastHLine(x0 - y, y0 + r, y + y + delta, color);
+    if (cornername & 0x2) drawFastHLine(x0 - y, y0 - r, y + y + delta, color);
+  }
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color)
+{
+  drawFastHLine(x + r, y, w - r - r, color);
+  drawFastHLine(x + r, y + h - 1, w - r - r, color);
+  drawFastVLine(x, y + r, h - r - r, color);
+  drawFastVLine(x + w - 1, y + r, h - r - r, color);
+  drawCircleHelper(x + r, y + r, r, 1, color);
+  drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+  drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+  drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t color)
+{
+  fillRect(x, y + r, w, h - r - r, color);
+  fillCircleHelper(x + r, y + h - r - 1, r, 1, w - r - r - 1, color);
+  fillCircleHelper(x + r, y + r, r, 2, w - r - r - 1, color);
+}
+
+// Sent as it is, so it's not counted: whoever pushes reports the window
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
+{
+  int32_t dx = x, dy = y, dw = w, dh = h;
+  if (!clip(dx, dy, dw, dh)) {
+    return;
+  }
+  int32_t skipX = dx - (x + _xDatum);
+  int32_t skipY = dy - (y + _yDatum);
+  uint16_t *pixels = new uint16_t[dw * dh];
+  for (int32_t row = 0; row < dh; row++) {
+    for (int32_t column = 0; column < dw; column++) {
+      uint16_t pixel = data[(skipY + row) * w + skipX + column];
+      // Without swapping the bytes go out in memory order, high byte first
+      pixels[row * dw + column] = _swapBytes ? pixel : (uint16_t)(pixel << 8 | pixel >> 8);
+    }
+  }
+  writeWindow(dx, dy, dw, dh, 0, pixels);
+  delete[] pixels;
+}
+
+void TFT_eSPI::setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill)
+{
+  textcolor = fgcolor;
+  textbgcolor = bgcolor;
+}
+
+void TFT_eSPI::setTextFont(uint8_t font)
+{
+  textfont = font > 0 ? font : 1;
+  gfxFont = nullptr;
+}
+
+void TFT_eSPI::setFreeFont(const GFXfont *f)
+{
+  if (f == nullptr) {
+    setTextFont(1);
+    return;
+  }
+  textfont = 1;
+  gfxFont = (GFXfont *)f;
+
+  glyph_ab = 0;
+  glyph_bb = 0;
+  uint16_t numChars = gfxFont->last - gfxFont->first;
+  for (uint16_t c = 0; c < numChars; c++) {
+    const GFXglyph &glyph = gfxFont->glyph[c];
+    int8_t ab = -glyph.yOffset;
+    if (ab > glyph_ab) {
+      glyph_ab = ab;
+    }
+    int8_t bb = glyph.height - ab;
+    if (bb > glyph_bb) {
+      glyph_bb = bb;
+    }
+  }
+}
+
+// The last character of a free font string counts its ink, not its advance
+int16_t TFT_eSPI::textWidth(const char *string, uint8_t font)
+{
+  int32_t width = 0;
+  if (font == 1 && gfxFont != nullptr) {
+    while (*string) {
+      uint16_t c = (uint8_t)*string++;
+      if (c >= gfxFont->first && c <= gfxFont->last) {
+        const GFXglyph &glyph = gfxFont->glyph[c - gfxFont->first];
+        if (*string) {
+          width += glyph.xAdvance;
+        } else {
+          width += glyph.xOffset + glyph.width;
+        }
+      }
+    }
+  } else {
+    width = strlen(string) * BUILTIN_CHAR_WIDTH;
+  }
+  return width * textsize;
+}
+
+int16_t TFT_eSPI::fontHeight(uint8_t font)
+{
+  if (font == 1 && gfxFont != nullptr) {
+    return gfxFont->yAdvance * textsize;
+  }
+  return BUILTIN_CHAR_HEIGHT * textsize;
+}
+
+void TFT_eSPI::drawChar(int32_t x, int32_t y, uint16_t c, uint32_t color, uint32_t bg, uint8_t size)
+{
+  if (gfxFont == nullptr || c < gfxFont->first || c > gfxFont->last) {
+    return;
+  }
+  const GFXglyph &glyph = gfxFont->glyph[c - gfxFont->first];
+  const uint8_t *bitmap = gfxFont->bitmap;
+  uint32_t bo = glyph.bitmapOffset;
+  int16_t xo16 = size > 1 ? glyph.xOffset : 0;
+  int16_t yo16 = size > 1 ? glyph.yOffset : 0;
+  uint8_t bits = 0, bit = 0;
+
+  // Runs of set pixels in each row go out as one line
+  uint16_t hpc = 0;
+  for (uint8_t yy = 0; yy < glyph.height; yy++) {
+    uint8_t xx;
+    for (xx = 0; xx < glyph.width; xx++) {
+      if (bit == 0) {
+        bits = bitmap[bo++];
+        bit = 0x80;
+      }
+      if (bits & bit) {
+        hpc++;
+      } else if (hpc) {
+        if (size == 1) drawFastHLine(x + glyph.xOffset + xx - hpc, y + glyph.yOffset + yy, hpc, color);
+        else fillRect(x + (xo16 + xx - hpc) * size, y + (yo16 + yy) * size, size * hpc, size, color);
+        hpc = 0;
+      }
+      bit >>= 1;
+    }
+    if (hpc) {
+      if (size == 1) drawFastHLine(x + glyph.xOffset + xx - hpc, y + glyph.yOffset + yy, hpc, color);
+      else fillRect(x + (xo16 + xx - hpc) * size, y + (yo16 + yy) * size, size * hpc, size, color);
+      hpc = 0;
+    }
+  }
+}
+
+// One window per character with its background, as the library sends
+// the built in fonts, or just the ink when drawn without one
+void TFT_eSPI::drawBuiltinChar(int32_t x, int32_t y, uint16_t c)
+{
+  const GFXfont *font = &FreeMono9pt7b;
+  GFXfont *savedFont = gfxFont;
+  gfxFont = (GFXfont *)font;
+  int32_t baseline = y + BUILTIN_CHAR_HEIGHT - 4;
+  if (textcolor == textbgcolor) {
+    drawChar(x, baseline, c, textcolor, textbgcolor, 1);
+    gfxFont = savedFont;
+    return;
+  }
+
+  uint16_t cell[BUILTIN_CHAR_WIDTH * BUILTIN_CHAR_HEIGHT];
+  for (uint16_t &pixel : cell) {
+    pixel = textbgcolor;
+  }
+  if (c >= font->first && c <= font->last) {
+    const GFXglyph &glyph = font->glyph[c - font->first];
+    uint32_t bo = glyph.bitmapOffset;
+    uint8_t bits = 0, bit = 0;
+    for (uint8_t yy = 0; yy < glyph.height; yy++) {
+      for (uint8_t xx = 0; xx < glyph.width; xx++) {
+        if (bit == 0) {
+          bits = font->bitmap[bo++];
+          bit = 0x80;
+        }
+        int32_t cellX = glyph.xOffset + xx;
+        int32_t cellY = BUILTIN_CHAR_HEIGHT - 4 + glyph.yOffset + yy;
+        if ((bits & bit) && cellX >= 0 && cellX < BUILTIN_CHAR_WIDTH && cellY >= 0 && cellY < BUILTIN_CHAR_HEIGHT) {
+          cell[cellY * BUILTIN_CHAR_WIDTH + cellX] = textcolor;
+        }
+        bit >>= 1;
+      }
+    }
+  }
+  gfxFont = savedFont;
+
+  int32_t dx = x, dy = y, dw = BUILTIN_CHAR_WIDTH, dh = BUILTIN_CHAR_HEIGHT;
+  if (!clip(dx, dy, dw, dh)) {
+    return;
+  }
+  int32_t skipX = dx - (x + _xDatum);
+  int32_t skipY = dy - (y + _yDatum);
+  uint16_t clipped[BUILTIN_CHAR_WIDTH * BUILTIN_CHAR_HEIGHT];
+  for (int32_t row = 0; row < dh; row++) {
+    for (int32_t column = 0; column < dw; column++) {
+      clipped[row * dw + column] = cell[(skipY + row) * BUILTIN_CHAR_WIDTH + skipX + column];
+    }
+  }
+  writeWindow(dx, dy, dw, dh, 0, clipped);
+}
+
+int16_t TFT_eSPI::drawChar(uint16_t uniCode, int32_t x, int32_t y, uint8_t font)
+{
+  if (_vpOoB || !uniCode) {
+    return 0;
+  }
+  if (font == 1 && gfxFont != nullptr) {
+    drawChar(x, y, uniCode, textcolor, textbgcolor, textsize);
+    if (uniCode < gfxFont->first || uniCode > gfxFont->last) {
+      return 0;
+    }
+    return gfxFont->glyph[uniCode - gfxFont->first].xAdvance * textsize;
+  }
+  drawBuiltinChar(x, y, uniCode);
+  return BUILTIN_CHAR_WIDTH;
+}
+
+int16_t TFT_eSPI::drawString(const char *string, int32_t poX, int32_t poY, uint8_t font)
+{
+  int16_t sumX = 0;
+  uint8_t padding = 1;
+  uint16_t baseline = 0;
+  uint16_t cwidth = textWidth(string, font);
+  uint16_t cheight = 8 * textsize;
+  bool freeFont = font == 1 && gfxFont != nullptr;
+
+  if (freeFont) {
+    cheight = glyph_ab * textsize;
+    poY += cheight; // Free fonts are drawn from their baseline
+    baseline = cheight;
+    padding = 101;
+    if (textdatum == BL_DATUM || textdatum == BC_DATUM || textdatum == BR_DATUM) {
+      cheight += glyph_bb * textsize;
+    }
+  } else {
+    baseline = (BUILTIN_CHAR_HEIGHT - 4) * textsize;
+    cheight = fontHeight(font);
+  }
+
+  if (textdatum || padX) {
+    switch (textdatum) {
+      case TC_DATUM: poX -= cwidth / 2; padding += 1; break;
+      case TR_DATUM: poX -= cwidth; padding += 2; break;
+      case ML_DATUM: poY -= cheight / 2; break;
+      case MC_DATUM: poX -= cwidth / 2; poY -= cheight / 2; padding += 1; break;
+      case MR_DATUM: poX -= cwidth; poY -= cheight / 2; padding += 2; break;
+      case BL_DATUM: poY -= cheight; break;
+      case BC_DATUM: poX -= cwidth / 2; poY -= cheight; padding += 1; break;
+      case BR_DATUM: poX -= cwidth; poY -= cheight; padding += 2; break;
+      case L_BASELINE: poY -= baseline; break;
+      case C_BASELINE: poX -= cwidth / 2; poY -= baseline; padding += 1; break;
+      case R_BASELINE: poX -= cwidth; poY -= baseline; padding += 2; break;
+    }
+  }
+
+  // A free font's background is one fill under the whole string
+  int8_t xo = 0;
+  if (freeFont && textcolor != textbgcolor) {
+    cheight = (glyph_ab + glyph_bb) * textsize;
+    uint16_t c2 = (uint8_t)string[0];
+    if (c2 >= gfxFont->first && c2 <= gfxFont->last) {
+      xo = gfxFont->glyph[c2 - gfxFont->first].xOffset * textsize;
+      if (xo > 0) {
+        xo = 0;
+      } else {
+        cwidth -= xo;
+      }
+      fillRect(poX + xo, poY - glyph_ab * textsize, cwidth, cheight, textbgcolor);
+    }
+    padding -= 100;
+  }
+
+  for (const char *c = string; *c; c++) {
+    sumX += drawChar((uint8_t)*c, poX + sumX, poY, font);
+  }
+
+  if (padX > cwidth && textcolor != textbgcolor) {
+    int16_t padXc = poX + cwidth + xo;
+    if (freeFont) {
+      poX += xo;
+      poY -= glyph_ab * textsize;
+      sumX += poX;
+    }
+    switch (padding) {
+      case 1:
+        fillRect(padXc, poY, padX - cwidth, cheight, textbgcolor);
+        break;
+      case 2:
+        fillRect(padXc, poY, (padX - cwidth) >> 1, cheight, textbgcolor);
+        padXc = poX - ((padX - cwidth) >> 1);
+        fillRect(padXc, poY, (padX - cwidth) >> 1, cheight, textbgcolor);
+        break;
+      case 3:
+        if (padXc > padX) {
+          padXc = padX;
+        }
+        fillRect(poX + cwidth - padXc, poY, padXc - cwidth, cheight, textbgcolor);
+        break;
+    }
+  }
+  return sumX;
+}
+
+size_t TFT_eSPI::write(uint8_t c)
+{
+  if (gfxFont == nullptr) {
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += BUILTIN_CHAR_HEIGHT * textsize;
+    } else if (c != '\r') {
+      drawBuiltinChar(cursor_x, cursor_y, c);
+      cursor_x += BUILTIN_CHAR_WIDTH * textsize;
+    }
+    return 1;
+  }
+
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += textsize * gfxFont->yAdvance;
+  } else if (c != '\r' && c >= gfxFont->first && c <= gfxFont->last) {
+    const GFXglyph &glyph = gfxFont->glyph[c - gfxFont->first];
+    if (glyph.width > 0 && glyph.height > 0) {
+      drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+    }
+    cursor_x += glyph.xAdvance * textsize;
+  }
+  return 1;
+}
+
+bool TFT_eSPI::getTouch(uint16_t *x, uint16_t *y, uint16_t threshold)
+{
+  if (!touchPressed) {
+    return false;
+  }
+  *x = touchX;
+  *y = touchY;
+  return true;
+}
+
+void TFT_eSPI::calibrateTouch(uint16_t *data, uint32_t color_fg, uint32_t color_bg, uint8_t size)
+{
+  for (uint8_t i = 0; i < 5; i++) {
+    data[i] = 0;
+  }
+}
+
+void TFT_eSPI::setTouch(uint16_t *data)
+{
+}
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI *tft)
+    : TFT_eSPI(0, 0)
+{
+}
+
+TFT_eSprite::~TFT_eSprite()
+{
+  deleteSprite();
+}
+
+void *TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames)
+{
+  if (_img != nullptr) {
+    return _img;
+  }
+  if (w < 1 || h < 1) {
+    return nullptr;
+  }
+  _img = new uint16_t[w * h]();
+  _init_width = _width = w;
+  _init_height = _height = h;
+  rotation = 0;
+  resetViewport();
+  return _img;
+}
+
+void TFT_eSprite::deleteSprite()
+{
+  delete[] _img;
+  _img = nullptr;
+}
+
+void TFT_eSprite::fillSprite(uint32_t color)
+{
+  fillRect(0, 0, _width, _height, color);
+}
+
+// Off-screen, so nothing is sent and no time passes
+void TFT_eSprite::writeWindow(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color, const uint16_t *pixels)
+{
+  if (_img == nullptr) {
+    return;
+  }
+  for (int32_t row = 0; row < h; row++) {
+    uint16_t *line = _img + (y + row) * _width + x;
+    for (int32_t column = 0; column < w; column++) {
+      uint16_t pixel = pixels != nullptr ? pixels[row * w + column] : color;
+      line[column] = pixel << 8 | pixel >> 8;
+    }
+  }
+}
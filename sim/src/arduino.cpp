@@ -0,0 +1,193 @@
+#include <Arduino.h>
+#include <stdarg.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "esp_timer.h"
+#include "sim_host.h"
+
+HardwareSerial Serial;
+
+// Read by the CAN task too, which only runs while the main loop waits for it
+static std::atomic<uint64_t> nowNs{0};
+
+// Once on the wall clock, simNowNs() carries on from where virtual time was
+static std::atomic<bool> onWallClock{false};
+static int64_t wallOffsetNs;
+static thread_local uint64_t sleepOwedNs = 0;
+
+static int64_t steadyNs()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void simUseWallClock()
+{
+  wallOffsetNs = nowNs.load() - steadyNs();
+  onWallClock = true;
+}
+
+bool simOnWallClock()
+{
+  return onWallClock.load();
+}
+
+uint64_t simNowNs()
+{
+  if (onWallClock.load()) {
+    return steadyNs() + wallOffsetNs;
+  }
+  return nowNs.load();
+}
+
+// On the wall clock, time spent sending to the display is slept, a
+// millisecond at a time so tiny windows don't each pay for a sleep
+void simAdvanceNs(uint64_t ns)
+{
+  if (!onWallClock.load()) {
+    nowNs += ns;
+    return;
+  }
+  sleepOwedNs += ns;
+  if (sleepOwedNs >= 1000000) {
+    std::this_thread::sleep_for(std::chrono::nanoseconds(sleepOwedNs));
+    sleepOwedNs = 0;
+  }
+}
+
+void simAdvanceTo(uint64_t ns)
+{
+  if (onWallClock.load()) {
+    uint64_t now = simNowNs();
+    if (ns > now) {
+      std::this_thread::sleep_for(std::chrono::nanoseconds(ns - now));
+    }
+    return;
+  }
+  if (ns > nowNs.load()) {
+    nowNs = ns;
+  }
+}
+
+int64_t esp_timer_get_time()
+{
+  return simNowNs() / 1000;
+}
+
+unsigned long millis()
+{
+  return simNowNs() / 1000000;
+}
+
+unsigned long micros()
+{
+  return simNowNs() / 1000;
+}
+
+void delay(uint32_t ms)
+{
+  simAdvanceNs((uint64_t)ms * 1000000);
+}
+
+void yield()
+{
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+}
+
+uint32_t getCpuFrequencyMhz()
+{
+  return 240;
+}
+
+String::String(double value, unsigned int decimals)
+{
+  char text[32];
+  snprintf(text, sizeof(text), "%.*f", decimals, value);
+  _text = text;
+}
+
+String &String::operator+=(const String &other)
+{
+  _text += other._text;
+  return *this;
+}
+
+String operator+(const String &left, const String &right)
+{
+  String result = left;
+  result += right;
+  return result;
+}
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t written = 0;
+  while (size--) {
+    written += write(*buffer++);
+  }
+  return written;
+}
+
+size_t Print::printf(const char *format, ...)
+{
+  char small[128];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(small, sizeof(small), format, args);
+  va_end(args);
+  if (length < 0) {
+    return 0;
+  }
+  if ((size_t)length < sizeof(small)) {
+    return write((const uint8_t *)small, length);
+  }
+
+  std::string large(length + 1, '\0');
+  va_start(args, format);
+  vsnprintf(&large[0], large.size(), format, args);
+  va_end(args);
+  return write((const uint8_t *)large.data(), length);
+}
+
+size_t Stream::readBytes(char *buffer, size_t length)
+{
+  size_t count = 0;
+  while (count < length) {
+    int c = read();
+    if (c < 0) {
+      break;
+    }
+    buffer[count++] = (char)c;
+  }
+  return count;
+}
+
+size_t Stream::readBytesUntil(char terminator, char *buffer, size_t length)
+{
+  size_t count = 0;
+  while (count < length) {
+    int c = read();
+    if (c < 0 || c == terminator) {
+      break;
+    }
+    buffer[count++] = (char)c;
+  }
+  return count;
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+  return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+  return fwrite(buffer, 1, size, stdout);
+}
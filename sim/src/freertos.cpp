@@ -0,0 +1,53 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "sim_host.h"
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+struct SimSemaphore
+{
+  std::timed_mutex mutex;
+};
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stackDepth, void *parameter,
+                                   UBaseType_t priority, TaskHandle_t *createdTask, BaseType_t core)
+{
+  std::thread *thread = new std::thread(task, parameter);
+  thread->detach();
+  if (createdTask != nullptr) {
+    *createdTask = thread;
+  }
+  return pdPASS;
+}
+
+// Virtual time doesn't pass while a task waits, so only yield on it
+void vTaskDelay(TickType_t ticks)
+{
+  if (simOnWallClock()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+  } else {
+    std::this_thread::yield();
+  }
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+  return new SimSemaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+  if (ticks == portMAX_DELAY) {
+    semaphore->mutex.lock();
+    return pdTRUE;
+  }
+  return semaphore->mutex.try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+  semaphore->mutex.unlock();
+  return pdTRUE;
+}
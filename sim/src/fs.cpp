@@ -0,0 +1,124 @@
+#include "FS.h"
+#include "SPIFFS.h"
+#include "sim_host.h"
+#include <dirent.h>
+#include <map>
+
+fs::SPIFFSFS SPIFFS;
+
+static std::map<std::string, std::shared_ptr<std::vector<uint8_t>>> files;
+
+void simFsPut(const char *path, const uint8_t *data, size_t size)
+{
+  files[path] = std::make_shared<std::vector<uint8_t>>(data, data + size);
+}
+
+bool simFsLoadDir(const char *hostDir)
+{
+  DIR *dir = opendir(hostDir);
+  if (dir == nullptr) {
+    return false;
+  }
+  while (struct dirent *entry = readdir(dir)) {
+    if (entry->d_name[0] == '.') {
+      continue;
+    }
+    std::string hostPath = std::string(hostDir) + "/" + entry->d_name;
+    FILE *file = fopen(hostPath.c_str(), "rb");
+    if (file == nullptr) {
+      continue;
+    }
+    std::vector<uint8_t> data;
+    uint8_t buffer[4096];
+    size_t length;
+    while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+      data.insert(data.end(), buffer, buffer + length);
+    }
+    fclose(file);
+    simFsPut(("/" + std::string(entry->d_name)).c_str(), data.data(), data.size());
+  }
+  closedir(dir);
+  return true;
+}
+
+namespace fs
+{
+
+size_t File::write(const uint8_t *buffer, size_t size)
+{
+  if (_data == nullptr || !_writable) {
+    return 0;
+  }
+  if (_data->size() < _position + size) {
+    _data->resize(_position + size);
+  }
+  memcpy(_data->data() + _position, buffer, size);
+  _position += size;
+  return size;
+}
+
+int File::available()
+{
+  return _data != nullptr ? _data->size() - _position : 0;
+}
+
+int File::read()
+{
+  if (available() <= 0) {
+    return -1;
+  }
+  return (*_data)[_position++];
+}
+
+int File::peek()
+{
+  if (available() <= 0) {
+    return -1;
+  }
+  return (*_data)[_position];
+}
+
+size_t File::read(uint8_t *buffer, size_t size)
+{
+  size_t count = min(size, (size_t)max(available(), 0));
+  if (count > 0) {
+    memcpy(buffer, _data->data() + _position, count);
+    _position += count;
+  }
+  return count;
+}
+
+File FS::open(const char *path, const char *mode)
+{
+  auto found = files.find(path);
+  if (mode[0] == 'w') {
+    auto data = std::make_shared<std::vector<uint8_t>>();
+    files[path] = data;
+    return File(data, true, 0);
+  }
+  if (found == files.end()) {
+    if (mode[0] != 'a') {
+      return File();
+    }
+    found = files.emplace(path, std::make_shared<std::vector<uint8_t>>()).first;
+  }
+  return File(found->second, mode[0] == 'a', mode[0] == 'a' ? found->second->size() : 0);
+}
+
+bool FS::exists(const char *path)
+{
+  return files.count(path) > 0;
+}
+
+bool FS::remove(const char *path)
+{
+  return files.erase(path) > 0;
+}
+
+bool SPIFFSFS::format()
+{
+  files.clear();
+  return true;
+}
+
+} // namespace fs
@@ -0,0 +1,93 @@
+#include "png_writer.h"
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+static uint32_t crc32(const uint8_t *data, size_t length, uint32_t crc = 0)
+{
+  static uint32_t table[256];
+  if (table[1] == 0) {
+    for (uint32_t n = 0; n < 256; n++) {
+      uint32_t c = n;
+      for (uint8_t k = 0; k < 8; k++) {
+        c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+      }
+      table[n] = c;
+    }
+  }
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++) {
+    crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+static void putBigEndian(std::vector<uint8_t> &out, uint32_t value)
+{
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    out.push_back(value >> shift);
+  }
+}
+
+static void putChunk(std::vector<uint8_t> &out, const char *type, const std::vector<uint8_t> &data)
+{
+  putBigEndian(out, data.size());
+  size_t start = out.size();
+  out.insert(out.end(), type, type + 4);
+  out.insert(out.end(), data.begin(), data.end());
+  putBigEndian(out, crc32(out.data() + start, out.size() - start));
+}
+
+bool writePng(const char *path, const uint16_t *pixels, uint16_t width, uint16_t height)
+{
+  // Each row starts with filter type 0, none
+  std::vector<uint8_t> raw;
+  raw.reserve((size_t)height * (1 + width * 3));
+  for (uint16_t y = 0; y < height; y++) {
+    raw.push_back(0);
+    for (uint16_t x = 0; x < width; x++) {
+      uint16_t pixel = pixels[y * width + x];
+      uint8_t r = pixel >> 11, g = (pixel >> 5) & 0x3F, b = pixel & 0x1F;
+      raw.push_back(r << 3 | r >> 2);
+      raw.push_back(g << 2 | g >> 4);
+      raw.push_back(b << 3 | b >> 2);
+    }
+  }
+
+  // zlib stream of stored deflate blocks
+  std::vector<uint8_t> zlib = {0x78, 0x01};
+  size_t offset = 0;
+  do {
+    uint16_t length = raw.size() - offset > 65535 ? 65535 : raw.size() - offset;
+    bool last = offset + length == raw.size();
+    zlib.push_back(last ? 1 : 0);
+    zlib.push_back(length & 0xFF);
+    zlib.push_back(length >> 8);
+    zlib.push_back(~length & 0xFF);
+    zlib.push_back((~length >> 8) & 0xFF);
+    zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + length);
+    offset += length;
+  } while (offset < raw.size());
+  uint32_t a = 1, b = 0;
+  for (uint8_t byte : raw) {
+    a = (a + byte) % 65521;
+    b = (b + a) % 65521;
+  }
+  putBigEndian(zlib, b << 16 | a);
+
+  std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  std::vector<uint8_t> header;
+  putBigEndian(header, width);
+  putBigEndian(header, height);
+  header.insert(header.end(), {8, 2, 0, 0, 0}); // 8 bit RGB
+  putChunk(png, "IHDR", header);
+  putChunk(png, "IDAT", zlib);
+  putChunk(png, "IEND", {});
+
+  FILE *file = fopen(path, "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  bool written = fwrite(png.data(), 1, png.size(), file) == png.size();
+  return fclose(file) == 0 && written;
+}
@@ -0,0 +1,111 @@
+#include "sim_can_bus.h"
+#include "esp_timer.h"
+#include "sim_host.h"
+#include <string.h>
+
+bool SimCanBus::load(const char *path)
+{
+  FILE *file = fopen(path, "r");
+  if (file == nullptr) {
+    return false;
+  }
+  char line[256];
+  CanLogFrame frame;
+  while (fgets(line, sizeof(line), file) != nullptr) {
+    line[strcspn(line, "\r\n")] = '\0';
+    if (parseCanLogLine(line, frame)) {
+      _frames.push_back(frame);
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+void SimCanBus::start(uint64_t startNs)
+{
+  _startNs = startNs;
+  _started = true;
+}
+
+uint64_t SimCanBus::endNs() const
+{
+  if (_frames.empty()) {
+    return _startNs;
+  }
+  return _startNs + (_frames.back().timestampUs - _frames.front().timestampUs) * 1000;
+}
+
+bool SimCanBus::frameDue() const
+{
+  if (!_started || finished()) {
+    return false;
+  }
+  uint64_t dueNs = _startNs + (_frames[_next].timestampUs - _frames.front().timestampUs) * 1000;
+  return dueNs <= simNowNs();
+}
+
+void SimCanBus::step()
+{
+  std::unique_lock<std::mutex> lock(_turnLock);
+  _turnChanged.wait(lock, [this] { return !_canTaskRunning; });
+  _canTaskRunning = true;
+  _turnChanged.notify_all();
+  _turnChanged.wait(lock, [this] { return !_canTaskRunning; });
+}
+
+bool SimCanBus::begin(long bitrate, const CanAcceptanceFilter &filter, const uint16_t *ids, uint16_t idCount)
+{
+  return true;
+}
+
+// The CAN task's only blocking point, so where it hands back to the main loop
+bool SimCanBus::waitForFrames(uint32_t timeoutMs)
+{
+  std::unique_lock<std::mutex> lock(_turnLock);
+  _canTaskRunning = false;
+  _turnChanged.notify_all();
+  _turnChanged.wait(lock, [this] { return _canTaskRunning; });
+  return frameDue();
+}
+
+// Every frame in the log, as if the acceptance filter let all of them through
+bool SimCanBus::receive(CanFrame &frame)
+{
+  if (!frameDue()) {
+    return false;
+  }
+  const CanLogFrame &logged = _frames[_next++];
+  frame.id = logged.id;
+  frame.extended = logged.extended;
+  frame.len = logged.len;
+  memcpy(frame.data, logged.data, sizeof(frame.data));
+  return true;
+}
+
+// On the wire at once; nothing on the bus answers
+bool SimCanBus::send(const CanFrame &frame, uint32_t timeoutMs)
+{
+  _framesSent++;
+  _lastTxDoneUs = esp_timer_get_time();
+  return true;
+}
+
+void SimCanBus::clearReceiveQueue()
+{
+  while (frameDue()) {
+    _next++;
+  }
+}
+
+bool SimCanBus::getStatus(CanTransportStatus &status)
+{
+  status = {};
+  for (size_t i = _next; i < _frames.size() && _started; i++) {
+    if (_startNs + (_frames[i].timestampUs - _frames.front().timestampUs) * 1000 > simNowNs()) {
+      break;
+    }
+    status.rxPending++;
+  }
+  status.lastTxDoneUs = _lastTxDoneUs;
+  return true;
+}
@@ -0,0 +1,340 @@
+// The dash's screen and CAN code on the host, drawing into an in-memory
+// display. A recorded CAN log stands in for the ECU and a script of
+// touches for the driver; screenshots are saved where the script asks and
+// the bytes each screen sent the panel are checked against a baseline.
+// With --socketcan the dash is on a real or virtual bus instead, in real
+// time, until the script's end or Ctrl-C.
+//
+//   program --can drive.log --touch drive.touch [--baseline drive.baseline]
+//           [--write-baseline FILE] [--tolerance PCT] [--fs DIR] [--out DIR]
+//   program --socketcan vcan0 [--touch drive.touch] ...
+//
+// Touch script lines are "<ms> <action>", ms counted from the end of setup:
+//   press X Y, release, tap X Y (held 100 ms), png NAME, end
+// Baseline lines are "<bytes/s> <screen state name>".
+
+#include "config.h"
+#include "haltech_can.h"
+#include "screen.h"
+#include "png_writer.h"
+#include "sim_can_bus.h"
+#include "sim_host.h"
+#include "socketcan_transport.h"
+#include <errno.h>
+#include <signal.h>
+#include <map>
+#include <sys/stat.h>
+#include <string>
+#include <vector>
+
+HaltechCan htc;
+
+#define SIM_STEP_NS 1000000ULL  // One main loop pass and one CAN task pass per ms
+#define SIM_TAP_MS 100
+#define SIM_RUN_ON_MS 1000      // After the last frame and touch, without an end
+#define SIM_DEFAULT_TOLERANCE 5 // Percent a screen may go over its baseline
+
+static volatile sig_atomic_t stopRequested = 0;
+
+static void requestStop(int signal)
+{
+  stopRequested = 1;
+}
+
+enum SimAction_e {
+  SIM_PRESS,
+  SIM_RELEASE,
+  SIM_PNG,
+  SIM_END,
+};
+
+struct SimEvent
+{
+  uint32_t ms;
+  SimAction_e action;
+  uint16_t x;
+  uint16_t y;
+  std::string name;
+};
+
+static bool loadTouchScript(const char *path, std::vector<SimEvent> &events)
+{
+  FILE *file = fopen(path, "r");
+  if (file == nullptr) {
+    fprintf(stderr, "Can't open %s\n", path);
+    return false;
+  }
+
+  char line[256];
+  for (uint32_t lineNumber = 1; fgets(line, sizeof(line), file) != nullptr; lineNumber++) {
+    line[strcspn(line, "#\r\n")] = '\0';
+    char action[16] = "";
+    char name[128] = "";
+    unsigned ms, x, y;
+    int fields = sscanf(line, "%u %15s", &ms, action);
+    if (fields <= 0) {
+      continue;
+    }
+
+    bool ok = fields == 2;
+    if (ok && (strcmp(action, "press") == 0 || strcmp(action, "tap") == 0)) {
+      ok = sscanf(line, "%*u %*s %u %u", &x, &y) == 2;
+      events.push_back({ms, SIM_PRESS, (uint16_t)x, (uint16_t)y, ""});
+      if (action[0] == 't') {
+        events.push_back({ms + SIM_TAP_MS, SIM_RELEASE, 0, 0, ""});
+      }
+    } else if (ok && strcmp(action, "release") == 0) {
+      events.push_back({ms, SIM_RELEASE, 0, 0, ""});
+    } else if (ok && strcmp(action, "png") == 0) {
+      ok = sscanf(line, "%*u %*s %127s", name) == 1;
+      events.push_back({ms, SIM_PNG, 0, 0, name});
+    } else if (ok && strcmp(action, "end") == 0) {
+      events.push_back({ms, SIM_END, 0, 0, ""});
+    } else {
+      ok = false;
+    }
+    if (!ok) {
+      fprintf(stderr, "%s:%u: can't read \"%s\"\n", path, lineNumber, line);
+      fclose(file);
+      return false;
+    }
+  }
+  fclose(file);
+
+  std::stable_sort(events.begin(), events.end(), [](const SimEvent &a, const SimEvent &b) { return a.ms < b.ms; });
+  return true;
+}
+
+static bool loadBaseline(const char *path, std::map<std::string, float> &baseline)
+{
+  FILE *file = fopen(path, "r");
+  if (file == nullptr) {
+    fprintf(stderr, "Can't open %s\n", path);
+    return false;
+  }
+  char line[128];
+  while (fgets(line, sizeof(line), file) != nullptr) {
+    line[strcspn(line, "#\r\n")] = '\0';
+    float bytesPerSecond;
+    int nameStart;
+    if (sscanf(line, "%f %n", &bytesPerSecond, &nameStart) == 1 && line[nameStart] != '\0') {
+      baseline[line + nameStart] = bytesPerSecond;
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+static float bytesPerSecond(const PanelTraffic &traffic)
+{
+  return traffic.bytes() * 1000.0f / traffic.ms;
+}
+
+// Each screen shown against its baseline. False if any went over by more
+// than tolerance percent.
+static bool checkBaseline(const std::map<std::string, float> &baseline, float tolerance)
+{
+  bool withinBaseline = true;
+  Serial.printf("Against the baseline (%.0f%% tolerance):\n", tolerance);
+  for (uint8_t state = 0; state < STATE_NONE; state++) {
+    PanelTraffic traffic = panelTraffic((ScreenState_e)state);
+    const char *name = screenStateName((ScreenState_e)state);
+    if (traffic.ms == 0) {
+      continue;
+    }
+    auto found = baseline.find(name);
+    if (found == baseline.end()) {
+      Serial.printf("  %-12s no baseline\n", name);
+      continue;
+    }
+    float rate = bytesPerSecond(traffic);
+    float change = 100.0f * (rate - found->second) / found->second;
+    bool over = change > tolerance;
+    Serial.printf("  %-12s %.0f B/s, baseline %.0f B/s (%+.1f%%)%s\n", name, rate, found->second, change, over ? " REGRESSION" : "");
+    withinBaseline = withinBaseline && !over;
+  }
+  return withinBaseline;
+}
+
+static bool writeBaseline(const char *path)
+{
+  FILE *file = fopen(path, "w");
+  if (file == nullptr) {
+    fprintf(stderr, "Can't write %s\n", path);
+    return false;
+  }
+  fprintf(file, "# Panel bytes/s per screen state, written by the simulator's --write-baseline\n");
+  for (uint8_t state = 0; state < STATE_NONE; state++) {
+    PanelTraffic traffic = panelTraffic((ScreenState_e)state);
+    if (traffic.ms > 0) {
+      fprintf(file, "%.0f %s\n", bytesPerSecond(traffic), screenStateName((ScreenState_e)state));
+    }
+  }
+  return fclose(file) == 0;
+}
+
+static bool savePng(const std::string &outDir, const std::string &name)
+{
+  std::string path = outDir + "/" + name + ".png";
+  if (!writePng(path.c_str(), tft.frameBuffer(), tft.width(), tft.height())) {
+    fprintf(stderr, "Can't write %s\n", path.c_str());
+    return false;
+  }
+  Serial.printf("Saved %s\n", path.c_str());
+  return true;
+}
+
+static int usage(const char *program)
+{
+  fprintf(stderr, "Usage: %s [--can LOG | --socketcan IFACE] [--touch SCRIPT] [--baseline FILE]\n"
+                  "          [--write-baseline FILE] [--tolerance PCT] [--fs DIR] [--out DIR]\n", program);
+  return 2;
+}
+
+int main(int argc, char **argv)
+{
+  const char *canPath = nullptr;
+  const char *socketCanInterface = nullptr;
+  const char *touchPath = nullptr;
+  const char *baselinePath = nullptr;
+  const char *writeBaselinePath = nullptr;
+  const char *fsDir = nullptr;
+  std::string outDir = ".";
+  float tolerance = SIM_DEFAULT_TOLERANCE;
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 >= argc) {
+      return usage(argv[0]);
+    }
+    std::string option = argv[i];
+    const char *value = argv[++i];
+    if (option == "--can") {
+      canPath = value;
+    } else if (option == "--socketcan") {
+      socketCanInterface = value;
+    } else if (option == "--touch") {
+      touchPath = value;
+    } else if (option == "--baseline") {
+      baselinePath = value;
+    } else if (option == "--write-baseline") {
+      writeBaselinePath = value;
+    } else if (option == "--tolerance") {
+      tolerance = atof(value);
+    } else if (option == "--fs") {
+      fsDir = value;
+    } else if (option == "--out") {
+      outDir = value;
+    } else {
+      return usage(argv[0]);
+    }
+  }
+
+  if (canPath != nullptr && socketCanInterface != nullptr) {
+    return usage(argv[0]);
+  }
+
+  std::vector<SimEvent> events;
+  std::map<std::string, float> baseline;
+  // Never freed: the CAN task is still waiting on them when the run ends
+  SimCanBus *bus = socketCanInterface == nullptr ? new SimCanBus : nullptr;
+  CanTransport *transport = bus;
+  if (socketCanInterface != nullptr) {
+    transport = new SocketCanTransport(socketCanInterface);
+    simUseWallClock();
+  }
+  if ((touchPath != nullptr && !loadTouchScript(touchPath, events)) ||
+      (baselinePath != nullptr && !loadBaseline(baselinePath, baseline))) {
+    return 2;
+  }
+  if (bus != nullptr && canPath != nullptr && !bus->load(canPath)) {
+    fprintf(stderr, "Can't open %s\n", canPath);
+    return 2;
+  }
+  if (mkdir(outDir.c_str(), 0755) != 0 && errno != EEXIST) {
+    fprintf(stderr, "Can't create %s\n", outDir.c_str());
+    return 2;
+  }
+  if (fsDir != nullptr && !simFsLoadDir(fsDir)) {
+    fprintf(stderr, "Can't read %s\n", fsDir);
+    return 2;
+  }
+
+  // Touches are given in screen coordinates, so skip calibrating
+  if (!SPIFFS.exists(CALIBRATION_FILE)) {
+    uint16_t calData[7] = {REPEAT_CAL + 1};
+    simFsPut(CALIBRATION_FILE, (const uint8_t *)calData, 14);
+  }
+
+  // As main.cpp's setup(), on the log or socket instead of the TWAI controller
+  htc.useTransport(*transport);
+  htc.loadSignalDefinitions(SIGNAL_DBC_FILE);
+  screenSetup();
+  if (!htc.begin(1000E3)) {
+    fprintf(stderr, "Haltech CAN init failed\n");
+    return 2;
+  }
+
+  uint64_t startNs = simNowNs();
+  uint64_t endNs = UINT64_MAX;
+  if (bus != nullptr) {
+    bus->start(startNs);
+    endNs = bus->endNs();
+    if (!events.empty()) {
+      endNs = max<uint64_t>(endNs, startNs + events.back().ms * 1000000ULL);
+    }
+    endNs += SIM_RUN_ON_MS * 1000000ULL;
+  }
+  signal(SIGINT, requestStop);
+
+  bool ok = true;
+  size_t nextEvent = 0;
+  for (uint64_t stepNs = startNs; simNowNs() < endNs && !stopRequested; stepNs += SIM_STEP_NS) {
+    // Drawing that took longer than a step leaves the next ones to catch up
+    simAdvanceTo(stepNs);
+    uint32_t ms = (simNowNs() - startNs) / 1000000;
+    while (nextEvent < events.size() && events[nextEvent].ms <= ms) {
+      const SimEvent &event = events[nextEvent++];
+      switch (event.action) {
+        case SIM_PRESS:
+          simSetTouch(true, event.x, event.y);
+          break;
+        case SIM_RELEASE:
+          simSetTouch(false, 0, 0);
+          break;
+        case SIM_PNG:
+          ok = savePng(outDir, event.name) && ok;
+          break;
+        case SIM_END:
+          endNs = simNowNs();
+          break;
+      }
+    }
+    if (simNowNs() >= endNs) {
+      break;
+    }
+
+    if (bus != nullptr) {
+      bus->step();
+    }
+    htc.process();
+    screenLoop();
+  }
+
+  if (bus != nullptr) {
+    Serial.printf("\nSimulated %.2f s, %u CAN frames sent\n", (simNowNs() - startNs) / 1e9, bus->framesSent());
+  } else {
+    Serial.printf("\nRan %.2f s on %s\n", (simNowNs() - startNs) / 1e9, socketCanInterface);
+  }
+  htc.printTxStats(Serial);
+  printRenderStats(Serial);
+  ok = printPanelTraffic(Serial) && ok;
+  if (baselinePath != nullptr) {
+    ok = checkBaseline(baseline, tolerance) && ok;
+  }
+  if (writeBaselinePath != nullptr) {
+    ok = writeBaseline(writeBaselinePath) && ok;
+  }
+
+  // Skip destructors, with the CAN task parked inside htc and the bus
+  fflush(stdout);
+  _Exit(ok ? 0 : 1);
+}
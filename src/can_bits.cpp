@@ -0,0 +1,59 @@
+#include "can_bits.h"
+#include <stddef.h>
+
+// Unsigned and signed decoders for a whole-byte field
+#define BYTE_DECODERS(start, bytes, order)                            \
+  {                                                                   \
+    extractSignal<(start) * 8, (bytes) * 8, order, false>,            \
+    extractSignal<(start) * 8, (bytes) * 8, order, true>              \
+  }
+#define NO_DECODERS {nullptr, nullptr}
+#define BYTE_DECODER_TABLE(order)                                                                                                \
+  {                                                                                                                              \
+    {BYTE_DECODERS(0, 1, order), BYTE_DECODERS(0, 2, order), BYTE_DECODERS(0, 3, order), BYTE_DECODERS(0, 4, order)},           \
+    {BYTE_DECODERS(1, 1, order), BYTE_DECODERS(1, 2, order), BYTE_DECODERS(1, 3, order), BYTE_DECODERS(1, 4, order)},           \
+    {BYTE_DECODERS(2, 1, order), BYTE_DECODERS(2, 2, order), BYTE_DECODERS(2, 3, order), BYTE_DECODERS(2, 4, order)},           \
+    {BYTE_DECODERS(3, 1, order), BYTE_DECODERS(3, 2, order), BYTE_DECODERS(3, 3, order), BYTE_DECODERS(3, 4, order)},           \
+    {BYTE_DECODERS(4, 1, order), BYTE_DECODERS(4, 2, order), BYTE_DECODERS(4, 3, order), BYTE_DECODERS(4, 4, order)},           \
+    {BYTE_DECODERS(5, 1, order), BYTE_DECODERS(5, 2, order), BYTE_DECODERS(5, 3, order), NO_DECODERS},                          \
+    {BYTE_DECODERS(6, 1, order), BYTE_DECODERS(6, 2, order), NO_DECODERS,                NO_DECODERS},                          \
+    {BYTE_DECODERS(7, 1, order), NO_DECODERS,                NO_DECODERS,                NO_DECODERS},                          \
+  }
+
+// Indexed by [start byte][byte count - 1][signed]. Little-endian fields are
+// only needed for signals loaded from a DBC; everything Haltech sends is
+// big-endian.
+static const SignalDecoder bigEndianByteDecoders[8][4][2] = BYTE_DECODER_TABLE(CAN_BIG_ENDIAN);
+static const SignalDecoder littleEndianByteDecoders[8][4][2] = BYTE_DECODER_TABLE(CAN_LITTLE_ENDIAN);
+
+// Single bit flags of one byte, MSB first
+#define BIT_DECODERS(byte)                                            \
+  {                                                                   \
+    extractSignal<(byte) * 8 + 0, 1, CAN_BIG_ENDIAN, false>,          \
+    extractSignal<(byte) * 8 + 1, 1, CAN_BIG_ENDIAN, false>,          \
+    extractSignal<(byte) * 8 + 2, 1, CAN_BIG_ENDIAN, false>,          \
+    extractSignal<(byte) * 8 + 3, 1, CAN_BIG_ENDIAN, false>,          \
+    extractSignal<(byte) * 8 + 4, 1, CAN_BIG_ENDIAN, false>,          \
+    extractSignal<(byte) * 8 + 5, 1, CAN_BIG_ENDIAN, false>,          \
+    extractSignal<(byte) * 8 + 6, 1, CAN_BIG_ENDIAN, false>,          \
+    extractSignal<(byte) * 8 + 7, 1, CAN_BIG_ENDIAN, false>           \
+  }
+
+static const SignalDecoder bitDecoders[8][8] = {
+  BIT_DECODERS(0), BIT_DECODERS(1), BIT_DECODERS(2), BIT_DECODERS(3),
+  BIT_DECODERS(4), BIT_DECODERS(5), BIT_DECODERS(6), BIT_DECODERS(7),
+};
+
+SignalDecoder specializedDecoder(uint8_t startBit, uint8_t length, CanByteOrder_e order, bool isSigned)
+{
+  if (length == 1 && !isSigned && startBit < 64 && order == CAN_BIG_ENDIAN) {
+    return bitDecoders[startBit / 8][startBit % 8];
+  }
+
+  if (startBit % 8 == 0 && length % 8 == 0 && length >= 8 && length <= 32 && startBit < 64) {
+    const SignalDecoder (*byteDecoders)[4][2] = order == CAN_BIG_ENDIAN ? bigEndianByteDecoders : littleEndianByteDecoders;
+    return byteDecoders[startBit / 8][length / 8 - 1][isSigned ? 1 : 0];
+  }
+
+  return nullptr;
+}
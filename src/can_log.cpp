@@ -0,0 +1,155 @@
+#include "can_log.h"
+#include <stdlib.h>
+#include <ctype.h>
+
+static const char *skipSpaces(const char *p)
+{
+  while (*p == ' ' || *p == '\t') {
+    p++;
+  }
+  return p;
+}
+
+// "seconds.fraction" to microseconds, without going through a double so
+// epoch timestamps keep their microsecond resolution
+static const char *parseTimestamp(const char *p, uint64_t &timestampUs)
+{
+  char *end;
+  uint64_t seconds = strtoull(p, &end, 10);
+  if (end == p || *end != '.') {
+    return nullptr;
+  }
+  p = end + 1;
+
+  uint32_t fractionUs = 0;
+  uint8_t digits = 0;
+  while (isdigit((unsigned char)*p)) {
+    if (digits < 6) {
+      fractionUs = fractionUs * 10 + (*p - '0');
+      digits++;
+    }
+    p++;
+  }
+  for (; digits < 6; digits++) {
+    fractionUs *= 10;
+  }
+
+  timestampUs = seconds * 1000000ULL + fractionUs;
+  return p;
+}
+
+static int8_t hexDigit(char c)
+{
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// (1436509052.249713) can0 3E0#0102030405060708
+static bool parseCandumpLine(const char *p, CanLogFrame &frame)
+{
+  p = parseTimestamp(p + 1, frame.timestampUs);
+  if (p == nullptr || *p != ')') {
+    return false;
+  }
+
+  // Interface name
+  p = skipSpaces(p + 1);
+  while (*p != '\0' && *p != ' ' && *p != '\t') {
+    p++;
+  }
+  p = skipSpaces(p);
+
+  char *end;
+  frame.id = strtoul(p, &end, 16);
+  if (end == p || *end != '#') {
+    return false;
+  }
+  frame.extended = end - p > 3;
+  p = end + 1;
+
+  // "##" is CAN FD and "R" a remote frame, neither of which the dash sees
+  if (*p == '#' || *p == 'R') {
+    return false;
+  }
+
+  frame.len = 0;
+  while (frame.len < 8) {
+    int8_t high = hexDigit(p[0]);
+    int8_t low = high < 0 ? -1 : hexDigit(p[1]);
+    if (low < 0) {
+      break;
+    }
+    frame.data[frame.len++] = (high << 4) | low;
+    p += 2;
+    if (*p == '.') {
+      p++;
+    }
+  }
+  return true;
+}
+
+//    12.345678 1  3E0             Rx   d 8 01 02 03 04 05 06 07 08
+static bool parseAscLine(const char *p, CanLogFrame &frame)
+{
+  p = parseTimestamp(p, frame.timestampUs);
+  if (p == nullptr) {
+    return false;
+  }
+
+  // Channel
+  char *end;
+  p = skipSpaces(p);
+  strtoul(p, &end, 10);
+  if (end == p) {
+    return false;
+  }
+
+  p = skipSpaces(end);
+  frame.id = strtoul(p, &end, 16);
+  if (end == p) {
+    return false;
+  }
+  frame.extended = *end == 'x';
+  p = skipSpaces(frame.extended ? end + 1 : end);
+
+  if ((p[0] != 'R' && p[0] != 'T') || p[1] != 'x') {
+    return false;
+  }
+  p = skipSpaces(p + 2);
+  if (*p != 'd') {
+    return false;
+  }
+
+  p = skipSpaces(p + 1);
+  unsigned long dlc = strtoul(p, &end, 16);
+  if (end == p || dlc > 8) {
+    return false;
+  }
+  p = end;
+
+  for (frame.len = 0; frame.len < dlc; frame.len++) {
+    p = skipSpaces(p);
+    int8_t high = hexDigit(p[0]);
+    int8_t low = high < 0 ? -1 : hexDigit(p[1]);
+    if (low < 0) {
+      return false;
+    }
+    frame.data[frame.len] = (high << 4) | low;
+    p += 2;
+  }
+  return true;
+}
+
+bool parseCanLogLine(const char *line, CanLogFrame &frame)
+{
+  const char *p = skipSpaces(line);
+  if (*p == '(') {
+    return parseCandumpLine(p, frame);
+  }
+  if (isdigit((unsigned char)*p)) {
+    return parseAscLine(p, frame);
+  }
+  return false;
+}
@@ -0,0 +1,128 @@
+#include "can_tx_scheduler.h"
+#include <string.h>
+
+CanTxScheduler::CanTxScheduler()
+    : _periodicCount(0), _refresh(nullptr), _refreshContext(nullptr)
+{
+  memset(_head, 0, sizeof(_head));
+  memset(_count, 0, sizeof(_count));
+  resetStats();
+}
+
+void CanTxScheduler::setRefresh(CanFrameRefresh refresh, void *context)
+{
+  _refresh = refresh;
+  _refreshContext = context;
+}
+
+void CanTxScheduler::resetStats()
+{
+  memset(_stats, 0, sizeof(_stats));
+}
+
+int8_t CanTxScheduler::addPeriodic(uint32_t periodUs, int64_t now)
+{
+  if (_periodicCount == MAX_PERIODIC) {
+    return -1;
+  }
+
+  Periodic *periodic = &_periodic[_periodicCount];
+  periodic->periodUs = periodUs;
+  periodic->dueUs = now + periodUs;
+  periodic->releaseUs = now;
+  return _periodicCount++;
+}
+
+bool CanTxScheduler::periodicDue(uint8_t handle, int64_t now)
+{
+  Periodic *periodic = &_periodic[handle];
+  if (now < periodic->dueUs) {
+    return false;
+  }
+
+  // Whole periods that passed without a call are lost; release the frame
+  // for the current one rather than sending a burst to catch up
+  uint32_t periodsLate = (now - periodic->dueUs) / periodic->periodUs;
+  _stats[CAN_TX_PERIODIC].missedDeadlines += periodsLate;
+  periodic->releaseUs = periodic->dueUs + (int64_t)periodsLate * periodic->periodUs;
+  periodic->dueUs = periodic->releaseUs + periodic->periodUs;
+  return true;
+}
+
+int64_t CanTxScheduler::nextDueUs() const
+{
+  int64_t nextDue = INT64_MAX;
+  for (uint8_t handle = 0; handle < _periodicCount; handle++) {
+    if (_periodic[handle].dueUs < nextDue) {
+      nextDue = _periodic[handle].dueUs;
+    }
+  }
+  return nextDue;
+}
+
+bool CanTxScheduler::enqueue(const CanFrame &frame, CanTxPriority_e priority, int64_t releaseUs, int64_t deadlineUs)
+{
+  CanTxStats *stats = &_stats[priority];
+
+  if (priority == CAN_TX_PERIODIC) {
+    for (uint8_t i = 0; i < _count[priority]; i++) {
+      QueuedFrame *queued = &_queue[priority][(_head[priority] + i) % QUEUE_LEN];
+      if (queued->frame.id == frame.id && queued->frame.extended == frame.extended) {
+        // The frame for the previous period never made it out
+        queued->frame = frame;
+        queued->releaseUs = releaseUs;
+        queued->deadlineUs = deadlineUs;
+        stats->coalesced++;
+        stats->missedDeadlines++;
+        return true;
+      }
+    }
+  }
+
+  if (_count[priority] == QUEUE_LEN) {
+    stats->dropped++;
+    return false;
+  }
+
+  QueuedFrame *queued = &_queue[priority][(_head[priority] + _count[priority]) % QUEUE_LEN];
+  queued->frame = frame;
+  queued->releaseUs = releaseUs;
+  queued->deadlineUs = deadlineUs;
+  _count[priority]++;
+  return true;
+}
+
+bool CanTxScheduler::service(CanTransport &transport, int64_t now)
+{
+  for (uint8_t priority = 0; priority < CAN_TX_PRIORITY_COUNT; priority++) {
+    CanTxStats *stats = &_stats[priority];
+    while (_count[priority] > 0) {
+      QueuedFrame *queued = &_queue[priority][_head[priority]];
+
+      if (_refresh != nullptr) {
+        _refresh(queued->frame, _refreshContext);
+      }
+      // Lower priorities wait until everything above them is out
+      if (!transport.send(queued->frame, 0)) {
+        return false;
+      }
+
+      uint32_t latencyUs = now > queued->releaseUs ? now - queued->releaseUs : 0;
+      if (stats->sent == 0 || latencyUs < stats->minLatencyUs) {
+        stats->minLatencyUs = latencyUs;
+      }
+      if (latencyUs > stats->maxLatencyUs) {
+        stats->maxLatencyUs = latencyUs;
+      }
+      stats->totalLatencyUs += latencyUs;
+      if (queued->deadlineUs != 0 && now > queued->deadlineUs) {
+        stats->missedDeadlines++;
+      }
+      stats->sent++;
+
+      _head[priority] = (_head[priority] + 1) % QUEUE_LEN;
+      _count[priority]--;
+    }
+  }
+  return true;
+}
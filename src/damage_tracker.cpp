@@ -0,0 +1,111 @@
+#include "damage_tracker.h"
+#include <Arduino.h>
+
+bool DamageRect::intersects(const DamageRect &other) const
+{
+  return x < other.x + other.w && other.x < x + w &&
+         y < other.y + other.h && other.y < y + h;
+}
+
+DamageRect DamageRect::intersection(const DamageRect &other) const
+{
+  if (!intersects(other)) {
+    return {0, 0, 0, 0};
+  }
+  int16_t left = max(x, other.x);
+  int16_t top = max(y, other.y);
+  int16_t right = min(x + w, other.x + other.w);
+  int16_t bottom = min(y + h, other.y + other.h);
+  return {left, top, (int16_t)(right - left), (int16_t)(bottom - top)};
+}
+
+DamageRect DamageTracker::merged(const DamageRect &a, const DamageRect &b)
+{
+  int16_t left = min(a.x, b.x);
+  int16_t top = min(a.y, b.y);
+  int16_t right = max(a.x + a.w, b.x + b.w);
+  int16_t bottom = max(a.y + a.h, b.y + b.h);
+  return {left, top, (int16_t)(right - left), (int16_t)(bottom - top)};
+}
+
+// Overlapping rects always merge, so nothing is painted twice. Neighbours
+// merge when the bounding box is within an eighth of their combined area,
+// which joins buttons in a row or column but not ones that only touch
+// at a corner.
+bool DamageTracker::worthMerging(const DamageRect &a, const DamageRect &b)
+{
+  if (a.intersects(b)) {
+    return true;
+  }
+  // Pixels between them on each axis, negative where they overlap
+  int16_t gapX = max(b.x - (a.x + a.w), a.x - (b.x + b.w));
+  int16_t gapY = max(b.y - (a.y + a.h), a.y - (b.y + b.h));
+  if (gapX > DAMAGE_MERGE_GAP || gapY > DAMAGE_MERGE_GAP) {
+    return false;
+  }
+  int32_t separate = a.area() + b.area();
+  return merged(a, b).area() <= separate + separate / 8;
+}
+
+bool DamageTracker::covers(const DamageRect &area) const
+{
+  for (uint8_t i = 0; i < _count; i++) {
+    if (_rects[i].intersection(area).area() == area.area()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void DamageTracker::add(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+  DamageRect rect = {x, y, w, h};
+  if (_count < DAMAGE_MAX_RECTS) {
+    _rects[_count++] = rect;
+    return;
+  }
+
+  uint8_t best = 0;
+  int32_t bestGrowth = INT32_MAX;
+  for (uint8_t i = 0; i < _count; i++) {
+    int32_t growth = merged(_rects[i], rect).area() - _rects[i].area();
+    if (growth < bestGrowth) {
+      bestGrowth = growth;
+      best = i;
+    }
+  }
+  _rects[best] = merged(_rects[best], rect);
+}
+
+void DamageTracker::coalesce()
+{
+  // A merge can make the result worth merging with a rect already passed
+  // over, so keep going until a pass merges nothing
+  bool mergedAny = true;
+  while (mergedAny) {
+    mergedAny = false;
+    for (uint8_t i = 0; i < _count; i++) {
+      for (uint8_t j = i + 1; j < _count; j++) {
+        if (worthMerging(_rects[i], _rects[j])) {
+          _rects[i] = merged(_rects[i], _rects[j]);
+          _rects[j] = _rects[--_count];
+          mergedAny = true;
+          j = i;
+        }
+      }
+    }
+  }
+
+  for (uint8_t i = 1; i < _count; i++) {
+    DamageRect rect = _rects[i];
+    uint8_t j = i;
+    while (j > 0 && (_rects[j - 1].y > rect.y || (_rects[j - 1].y == rect.y && _rects[j - 1].x > rect.x))) {
+      _rects[j] = _rects[j - 1];
+      j--;
+    }
+    _rects[j] = rect;
+  }
+}
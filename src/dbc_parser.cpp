@@ -0,0 +1,175 @@
+#include "dbc_parser.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define DBC_EXTENDED_ID_FLAG 0x80000000UL
+
+static const char *skipSpaces(const char *p)
+{
+  while (*p == ' ' || *p == '\t') {
+    p++;
+  }
+  return p;
+}
+
+// Line starts with keyword followed by whitespace
+static const char *matchKeyword(const char *p, const char *keyword)
+{
+  p = skipSpaces(p);
+  size_t length = strlen(keyword);
+  if (strncmp(p, keyword, length) != 0 || (p[length] != ' ' && p[length] != '\t')) {
+    return nullptr;
+  }
+  return skipSpaces(p + length);
+}
+
+// Copy an identifier, truncating to size - 1 characters
+static const char *copyIdentifier(const char *p, char *out, size_t size)
+{
+  size_t length = 0;
+  while (isalnum((unsigned char)*p) || *p == '_') {
+    if (length < size - 1) {
+      out[length++] = *p;
+    }
+    p++;
+  }
+  out[length] = '\0';
+  return length > 0 ? p : nullptr;
+}
+
+static const char *parseMessageId(const char *p, uint32_t &id, bool &extended)
+{
+  char *end;
+  uint32_t raw = strtoul(p, &end, 10);
+  if (end == p) {
+    return nullptr;
+  }
+  extended = raw & DBC_EXTENDED_ID_FLAG;
+  id = raw & ~DBC_EXTENDED_ID_FLAG;
+  return end;
+}
+
+bool parseDbcMessage(const char *line, uint32_t &id, bool &extended)
+{
+  const char *p = matchKeyword(line, "BO_");
+  return p != nullptr && parseMessageId(p, id, extended) != nullptr;
+}
+
+bool parseDbcSignal(const char *line, DbcSignal &signal)
+{
+  const char *p = matchKeyword(line, "SG_");
+  if (p == nullptr) {
+    return false;
+  }
+
+  p = copyIdentifier(p, signal.name, sizeof(signal.name));
+  if (p == nullptr) {
+    return false;
+  }
+
+  // "M" marks the multiplexor, which decodes like any other signal, and
+  // "m<n>" a signal that's only present for one multiplexor value
+  p = skipSpaces(p);
+  if (*p == 'M') {
+    p = skipSpaces(p + 1);
+  } else if (*p == 'm') {
+    return false;
+  }
+  if (*p != ':') {
+    return false;
+  }
+  p = skipSpaces(p + 1);
+
+  // start|length@order sign
+  char *end;
+  unsigned long dbcStartBit = strtoul(p, &end, 10);
+  if (end == p || *end != '|' || dbcStartBit > 63) {
+    return false;
+  }
+  p = end + 1;
+  unsigned long length = strtoul(p, &end, 10);
+  if (end == p || end[0] != '@' || (end[1] != '0' && end[1] != '1') || (end[2] != '+' && end[2] != '-')) {
+    return false;
+  }
+  if (length < 1 || length > 32) {
+    return false;
+  }
+  signal.length = length;
+  signal.isSigned = end[2] == '-';
+
+  if (end[1] == '0') {
+    // DBC numbers Motorola start bits LSB-first within each byte, can_bits
+    // MSB-first
+    signal.order = CAN_BIG_ENDIAN;
+    signal.startBit = (dbcStartBit / 8) * 8 + (7 - dbcStartBit % 8);
+  } else {
+    signal.order = CAN_LITTLE_ENDIAN;
+    signal.startBit = dbcStartBit;
+  }
+  if (signalLastByte(signal.startBit, signal.length) > 7) {
+    return false;
+  }
+  p = skipSpaces(end + 3);
+
+  // (scale,offset)
+  if (*p != '(') {
+    return false;
+  }
+  signal.scale = strtof(p + 1, &end);
+  if (end == p + 1 || *end != ',') {
+    return false;
+  }
+  p = end + 1;
+  signal.offset = strtof(p, &end);
+  if (end == p || *end != ')') {
+    return false;
+  }
+  p = skipSpaces(end + 1);
+
+  // [min|max] isn't used; the unit is optional
+  if (*p == '[') {
+    p = strchr(p, ']');
+    if (p == nullptr) {
+      return false;
+    }
+    p = skipSpaces(p + 1);
+  }
+
+  size_t unitLength = 0;
+  if (*p == '"') {
+    for (p++; *p != '"' && *p != '\0'; p++) {
+      if (unitLength < sizeof(signal.unit) - 1) {
+        signal.unit[unitLength++] = *p;
+      }
+    }
+  }
+  signal.unit[unitLength] = '\0';
+  return true;
+}
+
+bool parseDbcCycleTime(const char *line, uint32_t &id, bool &extended, uint16_t &periodMs)
+{
+  const char *p = matchKeyword(line, "BA_");
+  if (p == nullptr || strncmp(p, "\"GenMsgCycleTime\"", 17) != 0) {
+    return false;
+  }
+
+  p = matchKeyword(p + 17, "BO_");
+  if (p == nullptr) {
+    return false;
+  }
+  p = parseMessageId(p, id, extended);
+  if (p == nullptr) {
+    return false;
+  }
+
+  char *end;
+  p = skipSpaces(p);
+  unsigned long period = strtoul(p, &end, 10);
+  if (end == p || period == 0 || period > 0xFFFF) {
+    return false;
+  }
+  periodMs = period;
+  return true;
+}
@@ -0,0 +1,54 @@
+#include "fixed_point_text.h"
+
+static const float decimalScales[FIXED_POINT_MAX_DECIMALS + 1] = {1.0f, 10.0f, 100.0f, 1000.0f, 10000.0f, 100000.0f, 1000000.0f};
+
+int32_t toFixedPoint(float value, uint8_t decimals)
+{
+  if (decimals > FIXED_POINT_MAX_DECIMALS) {
+    decimals = FIXED_POINT_MAX_DECIMALS;
+  }
+  float scaled = value * decimalScales[decimals];
+  // Also catches NaN, which fails both comparisons
+  if (!(scaled < 2147483520.0f)) {
+    return scaled < 0.0f ? INT32_MIN : INT32_MAX;
+  }
+  if (scaled <= -2147483520.0f) {
+    return INT32_MIN;
+  }
+  return (int32_t)(scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f);
+}
+
+size_t formatFixedPoint(int32_t fixed, uint8_t decimals, char *out, size_t size)
+{
+  if (size == 0) {
+    return 0;
+  }
+  if (decimals > FIXED_POINT_MAX_DECIMALS) {
+    decimals = FIXED_POINT_MAX_DECIMALS;
+  }
+
+  // Digits are produced least significant first, then copied out reversed
+  char digits[12];
+  uint8_t count = 0;
+  uint32_t magnitude = fixed < 0 ? 0u - (uint32_t)fixed : (uint32_t)fixed;
+  do {
+    digits[count++] = '0' + magnitude % 10;
+    magnitude /= 10;
+  } while (magnitude > 0 || count <= decimals);
+
+  size_t length = 0;
+  if (fixed < 0 && length < size - 1) {
+    out[length++] = '-';
+  }
+  while (count > 0 && length < size - 1) {
+    if (count == decimals) {
+      out[length++] = '.';
+      if (length == size - 1) {
+        break;
+      }
+    }
+    out[length++] = digits[--count];
+  }
+  out[length] = '\0';
+  return length;
+}
@@ -7,6 +7,52 @@
 #include <sstream>
 #include "screen.h"
 #include <iomanip>
+#include "config.h"
+#include "fixed_point_text.h"
+#include "esp_timer.h"
+
+ValueDrawStats valueDrawStats = {0, 0, 0, 0, 0};
+
+// Unit each built in signal is decoded into, indexed by HaltechDisplayType_e
+static constexpr HaltechUnit_e builtinIncomingUnits[] = {
+#define HT_SIGNAL(name, shortName, id, canId, startByte, endByte, incomingUnit, scale, offset, updatePeriodMs, isSigned, bitfieldPos) \
+    incomingUnit,
+#include "haltech_signals.def"
+#undef HT_SIGNAL
+};
+
+// Every option lists distinct, real units for a real signal, each one
+// reachable from the signal's incoming unit, and a signal has at most one
+// option list
+static constexpr bool unitOptionsConsistent()
+{
+  for (size_t i = 0; i < sizeof(unitOptions) / sizeof(unitOptions[0]); i++) {
+    const UnitOption &option = unitOptions[i];
+    if (option.type >= HT_NONE || option.count == 0 || option.count > sizeof(option.units) / sizeof(option.units[0])) {
+      return false;
+    }
+    for (uint8_t unit = 0; unit < option.count; unit++) {
+      if (option.units[unit] >= UNIT_NONE) {
+        return false;
+      }
+      if (!unitConversionMatrix.conversions[builtinIncomingUnits[option.type]][option.units[unit]].valid()) {
+        return false;
+      }
+      for (uint8_t other = 0; other < unit; other++) {
+        if (option.units[other] == option.units[unit]) {
+          return false;
+        }
+      }
+    }
+    for (size_t other = 0; other < i; other++) {
+      if (unitOptions[other].type == option.type) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+static_assert(unitOptionsConsistent(), "unitOptions has a bad signal, unit or count, or a unit missing from unitBase()");
 
 HaltechButton::HaltechButton()
     : _gfx(nullptr),
@@ -20,7 +66,7 @@ HaltechButton::HaltechButton()
 
 }
 
-void HaltechButton::initButton(TFT_eSPI *gfx, int16_t x1, int16_t y1, uint16_t w, uint16_t h, uint16_t outline, uint16_t fill, uint16_t textcolor, uint8_t textsize, HaltechDashValue* dashValue, HaltechUnit_e unit, int8_t decimalPlaces, buttonMode_e mode, float alertMin, float alertMax, bool alertBeepEnabled, bool alertFlashEnabled)
+void HaltechButton::initButton(TFT_eSPI *gfx, int16_t x1, int16_t y1, uint16_t w, uint16_t h, uint16_t outline, uint16_t fill, uint16_t textcolor, uint8_t textsize, const HaltechDashValue* dashValue, HaltechUnit_e unit, int8_t decimalPlaces, buttonMode_e mode, float alertMin, float alertMax, bool alertBeepEnabled, bool alertFlashEnabled, bool alertStaleEnabled, buttonWidget_e widget)
 {
   _x1             = x1;
   _y1             = y1;
@@ -32,13 +78,18 @@ void HaltechButton::initButton(TFT_eSPI *gfx, int16_t x1, int16_t y1, uint16_t w
   _textsize       = textsize;
   _gfx            = gfx;
   this->dashValue = dashValue;
-  this->displayUnit = unit;
+  setDisplayUnit(unit);
   this->decimalPlaces = decimalPlaces;
   this->mode = mode;
   this->alertMin = alertMin;
   this->alertMax = alertMax;
   this->alertBeepEnabled = alertBeepEnabled;
   this->alertFlashEnabled = alertFlashEnabled;
+  this->alertStaleEnabled = alertStaleEnabled;
+  this->widget = widget;
+  _graphHead = 0;
+  _graphCount = 0;
+  _smoothInterval = 0;
 }
 
 // Adjust text datum and x, y deltas
@@ -54,19 +105,25 @@ void HaltechButton::drawValue() {
     return;
   }
 
-  char buffer[10];
+  char buffer[VALUE_TEXT_LENGTH];
 
   uint16_t fill, text;
 
-  float convertedValue = this->dashValue->convertToUnit(this->displayUnit);
-  alertConditionMet = (convertedValue > alertMax || convertedValue < alertMin) && this->dashValue->last_update_time != 0;
+  valueDrawStats.updates++;
+
+  float convertedValue = displayValue();
+  alertConditionMet = (convertedValue > alertMax || convertedValue < alertMin) && this->dashValue->hasUpdated();
+  if (alertStaleEnabled && this->dashValue->isStale()) {
+    alertConditionMet = true;
+  }
   drawInverted = alertFlashState && alertConditionMet;
-  snprintf(buffer, sizeof(buffer), "%.*f", max((int)decimalPlaces, 0), convertedValue);
+  uint8_t decimals = max((int)decimalPlaces, 0);
+  formatFixedPoint(toFixedPoint(convertedValue, decimals), decimals, buffer, sizeof(buffer));
 
   if (lastDrawInverted != drawInverted) {
     // If the inverted state has changed, we need to redraw the entire button
     lastDrawInverted = drawInverted;
-    drawButton();
+    invalidate();
     return;
   }
 
@@ -78,11 +135,59 @@ void HaltechButton::drawValue() {
     text    = _textcolor;
   }
 
+  // Grey out values that stopped updating
+  if (this->dashValue->isStale() && !drawInverted) {
+    text    = TFT_DARKGREY;
+  }
+
+  if (widget != WIDGET_NUMBER) {
+    valueRenderer.finish();
+    if (widget == WIDGET_BAR) {
+      drawBar(convertedValue, text, fill);
+    } else if (widget == WIDGET_SMOOTH_BAR) {
+      drawBar(smoothValue(convertedValue), text, fill);
+    } else {
+      drawGraph(convertedValue, text, fill);
+    }
+  }
+
+  // Same text in the same colours, nothing to send to the display
+  bool sameColors = text == _lastValueTextColor && fill == _lastValueFillColor;
+  if (sameColors && strcmp(buffer, _lastValueText) == 0) {
+    return;
+  }
+  valueDrawStats.redraws++;
+  int64_t startUs = esp_timer_get_time();
+
+  if (VALUE_RENDERING != VALUE_RENDER_DIRECT && valueRenderer.ready() && _w - 2 * VALUE_AREA_INSET >= valueRenderer.width()) {
+    int16_t areaX = _x1 + VALUE_AREA_INSET;
+    int16_t areaY = _y1 + (_h/2) - 4 + _yd - valueRenderer.height() / 2;
+    int16_t textX = (_w/2) + _xd - VALUE_AREA_INSET;
+    if (VALUE_RENDERING == VALUE_RENDER_GLYPHS) {
+      const char *previous = sameColors && _lastValueText[0] != '\0' ? _lastValueText : nullptr;
+      valueRenderer.drawCells(areaX, areaY, textX, buffer, previous, text, fill);
+    } else {
+      valueRenderer.draw(areaX, areaY, textX, buffer, text, fill);
+    }
+  } else {
+    drawValueDirect(buffer, text, fill);
+  }
+
+  strcpy(_lastValueText, buffer);
+  _lastValueTextColor = text;
+  _lastValueFillColor = fill;
+  valueDrawStats.drawUs += esp_timer_get_time() - startUs;
+}
+
+// Text straight to the display, padded to cover a longer previous value
+void HaltechButton::drawValueDirect(const char *valueText, uint16_t text, uint16_t fill)
+{
+  int64_t startUs = esp_timer_get_time();
   tft.setFreeFont(LABEL1_FONT);
   _gfx->setTextColor(text, fill);
 
   // Calculate current text width
-  uint16_t currentTextWidth = _gfx->textWidth(buffer);
+  uint16_t currentTextWidth = _gfx->textWidth(valueText);
   
   // Determine if we need padding to clear previous longer text
   uint16_t paddingWidth = 0;
@@ -101,24 +206,148 @@ void HaltechButton::drawValue() {
   // Set text datum to middle center for perfect centering
   _gfx->setTextDatum(MC_DATUM);
   
-  _gfx->drawString(buffer, _x1 + (_w/2) + _xd, _y1 + (_h/2) - 4 + _yd);
+  _gfx->drawString(valueText, _x1 + (_w/2) + _xd, _y1 + (_h/2) - 4 + _yd);
   
   // Store current text width for next comparison
   _lastValueTextWidth = currentTextWidth;
 
   tft.setFreeFont(LABEL2_FONT);
+  valueDrawStats.displayUs += esp_timer_get_time() - startUs;
 }
 
-void HaltechButton::drawGraph() {
+// Below the value, in place of the unit string and clear of the outline
+void HaltechButton::widgetArea(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const
+{
+  x = _x1 + VALUE_AREA_INSET;
+  w = min(_w - 2 * VALUE_AREA_INSET, WIDGET_MAX_COLUMNS);
+  y = _y1 + _h * 5 / 8;
+  h = _y1 + _h - 4 - y;
+}
 
+// Position of value between alertMin (0) and alertMax (size)
+int16_t HaltechButton::widgetScale(float value, int16_t size) const
+{
+  float range = alertMax - alertMin;
+  float fraction = range > 0 ? (value - alertMin) / range : 0;
+  if (!(fraction > 0)) {
+    return 0;
+  }
+  if (fraction > 1) {
+    fraction = 1;
+  }
+  return fraction * size + 0.5f;
 }
 
-void HaltechButton::drawBar() {
-  
+// Sweeps left to right, one column per new sample, with a blank column
+// ahead of the newest. Each update sends two columns.
+void HaltechButton::drawGraph(float value, uint16_t color, uint16_t fill) {
+  int16_t x, y, w, h;
+  widgetArea(x, y, w, h);
+
+  bool newSample = this->dashValue->hasUpdated() && this->dashValue->lastUpdateTime() != _graphLastUpdate;
+  if (newSample) {
+    _graphLastUpdate = this->dashValue->lastUpdateTime();
+    _graphSamples[_graphHead] = widgetScale(value, h - 1);
+    if (_graphCount < w) {
+      _graphCount++;
+    }
+  }
+
+  if (!_widgetDrawn || color != _widgetColor || fill != _widgetFill) {
+    _widgetDrawn = true;
+    _widgetColor = color;
+    _widgetFill = fill;
+    _gfx->fillRect(x, y, w, h, fill);
+    uint8_t gap = newSample ? (_graphHead + 1) % w : _graphHead;
+    for (uint8_t column = 0; column < _graphCount; column++) {
+      if (column != gap) {
+        drawGraphColumn(x, y, w, h, column);
+      }
+    }
+    if (newSample) {
+      _graphHead = gap;
+    }
+    return;
+  }
+
+  if (newSample) {
+    _gfx->drawFastVLine(x + _graphHead, y, h, fill);
+    drawGraphColumn(x, y, w, h, _graphHead);
+    _graphHead = (_graphHead + 1) % w;
+    _gfx->drawFastVLine(x + _graphHead, y, h, fill);
+  }
+}
+
+// Line from the previous column's sample to this one's
+void HaltechButton::drawGraphColumn(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t column) {
+  uint8_t sample = _graphSamples[column];
+  uint8_t previous = sample;
+  if (column > 0 || _graphCount == w) {
+    previous = _graphSamples[(column + w - 1) % w];
+  }
+  uint8_t top = max(sample, previous);
+  uint8_t bottom = min(sample, previous);
+  _gfx->drawFastVLine(x + column, y + h - 1 - top, top - bottom + 1, _widgetColor);
+}
+
+// Takes in the latest value and returns where the bar should be now: one
+// sample behind, moving towards the latest at the rate samples arrive
+float HaltechButton::smoothValue(float value) {
+  unsigned long updateTime = this->dashValue->lastUpdateTime();
+  if (updateTime != _smoothTime) {
+    float interval = updateTime - _smoothTime;
+    float expected = this->dashValue->updatePeriod();
+    if (_smoothInterval == 0 || interval > expected * STALE_TIMEOUT_MULTIPLIER) {
+      // First sample, or after a gap: jump rather than animate from stale data
+      _smoothInterval = expected > 0 ? expected : 1;
+      _smoothFrom = value;
+    } else {
+      _smoothInterval += (max(interval, 1.0f) - _smoothInterval) / 4;
+      _smoothFrom = smoothValueAt(updateTime);
+    }
+    _smoothTo = value;
+    _smoothTime = updateTime;
+    _smoothRate = (_smoothTo - _smoothFrom) / _smoothInterval;
+  }
+  return smoothValueAt(millis());
+}
+
+float HaltechButton::smoothValueAt(unsigned long now) const {
+  float elapsed = now - _smoothTime;
+  if (elapsed >= _smoothInterval) {
+    return _smoothTo;
+  }
+  return _smoothFrom + _smoothRate * elapsed;
+}
+
+bool HaltechButton::isAnimating() const {
+  return widget == WIDGET_SMOOTH_BAR && _smoothFrom != _smoothTo && millis() - _smoothTime < _smoothInterval;
+}
+
+// Only the difference between the old and new fill is painted
+void HaltechButton::drawBar(float value, uint16_t color, uint16_t fill) {
+  int16_t x, y, w, h;
+  widgetArea(x, y, w, h);
+  int16_t length = widgetScale(value, w);
+
+  if (!_widgetDrawn || color != _widgetColor || fill != _widgetFill) {
+    _widgetDrawn = true;
+    _widgetColor = color;
+    _widgetFill = fill;
+    _gfx->fillRect(x, y, length, h, color);
+    _gfx->fillRect(x + length, y, w - length, h, fill);
+  } else if (length > _barLength) {
+    _gfx->fillRect(x + _barLength, y, length - _barLength, h, color);
+  } else if (length < _barLength) {
+    _gfx->fillRect(x + length, y, _barLength - length, h, fill);
+  }
+  _barLength = length;
 }
 
 void HaltechButton::drawButton() {
   uint16_t fill, outline, text;
+
+  valueRenderer.finish();
   
   tft.setFreeFont(LABEL2_FONT);
   
@@ -147,6 +376,7 @@ void HaltechButton::drawButton() {
 
   // Reset text width tracking since we're redrawing the entire button
   _lastValueTextWidth = 0;
+  _lastValueText[0] = '\0';
 
   if (_gfx->textfont == 255) {
     _gfx->setCursor(_x1 + (_w / 8),
@@ -164,16 +394,24 @@ void HaltechButton::drawButton() {
 
     // Draw name of value on top
     _gfx->drawString(this->dashValue->short_name, _x1 + (_w/2) + _xd, _y1 + (_h/4) - 4 + _yd);
-    // Draw units on bottom
-    _gfx->drawString(unitDisplayStrings[this->displayUnit], _x1 + (_w/2) + _xd, _y1 + (_h*3/4) - 4 + _yd);
+    // Draw units on bottom, unless a bar or graph goes there
+    if (widget == WIDGET_NUMBER) {
+      _gfx->drawString(unitDisplayStrings[this->displayUnit], _x1 + (_w/2) + _xd, _y1 + (_h*3/4) - 4 + _yd);
+    }
+    _widgetDrawn = false;
 
     _gfx->setTextDatum(tempdatum);
 
     // Draw value, even if it's 0. Needed to draw over when it's pressed or unpressed.
     drawValue();
+    valueRenderer.finish();
   }
 }
 
+void HaltechButton::invalidate() {
+  screenDamage.add(_x1, _y1, _w, _h);
+}
+
 bool HaltechButton::contains(int16_t x, int16_t y) {
   return ((x >= _x1) && (x < (_x1 + _w)) &&
           (y >= _y1) && (y < (_y1 + _h)));
@@ -194,6 +432,20 @@ bool HaltechButton::isPressed() {
 bool HaltechButton::justPressed()  { return (pressedState && !previousPressedState); }
 bool HaltechButton::justReleased() { return (!pressedState && previousPressedState); }
 
+// Falls back to the signal's own unit if it can't be converted, e.g. a
+// layout saved before the signal was swapped for one from the DBC file
+void HaltechButton::setDisplayUnit(HaltechUnit_e unit)
+{
+  UnitConversion conversion = unitConversion(this->dashValue->incomingUnit, unit);
+  if (!conversion.valid()) {
+    Serial.printf("can't show %s in unit %d, using %s\n", this->dashValue->short_name, unit, unitDisplayStrings[this->dashValue->incomingUnit]);
+    unit = this->dashValue->incomingUnit;
+    conversion = unitConversion(unit, unit);
+  }
+  this->displayUnit = unit;
+  this->displayConversion = conversion;
+}
+
 void HaltechButton::changeUnits(menuSelectionDirection_e direction) {
   uint8_t nextUnitIndex = -1;
   for (const UnitOption& option : unitOptions) {
@@ -211,7 +463,7 @@ void HaltechButton::changeUnits(menuSelectionDirection_e direction) {
             nextUnitIndex = (i - 1 + option.count) % option.count; // add option count to make sure it doesn't go negative
           }
           Serial.printf("changing to unit %d\n", nextUnitIndex);
-          this->displayUnit = option.units[nextUnitIndex];
+          setDisplayUnit(option.units[nextUnitIndex]);
           drawMenu();
           return;
         }
@@ -220,7 +472,7 @@ void HaltechButton::changeUnits(menuSelectionDirection_e direction) {
       // Fallback: if no valid unit is found, set to the first unit in the list
       if (!validUnitFound) {
         Serial.printf("current unit is invalid, defaulting to first unit\n");
-        this->displayUnit = option.units[0];
+        setDisplayUnit(option.units[0]);
         drawMenu();
         return;
       }
@@ -228,15 +480,7 @@ void HaltechButton::changeUnits(menuSelectionDirection_e direction) {
   }
 
   // Fallback: if no UnitOption exists for the current dashValue, use its default unit
-  Serial.printf("no UnitOption found for type %d, searching dashValues for default unit\n", this->dashValue->type);
-
-  // Search through dashValues for a matching type
-  for (uint8_t i = 0; i < HT_NONE; i++) {
-    if (dashValues[i].type == this->dashValue->type) {
-      Serial.printf("found matching dashValue type %d, defaulting to unit %d\n", dashValues[i].type, dashValues[i].incomingUnit);
-      this->displayUnit = dashValues[i].incomingUnit;
-      drawMenu();
-      return;
-    }
-  }
+  Serial.printf("no UnitOption found for type %d, defaulting to unit %d\n", this->dashValue->type, this->dashValue->incomingUnit);
+  setDisplayUnit(this->dashValue->incomingUnit);
+  drawMenu();
 }
\ No newline at end of file
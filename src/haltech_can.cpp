@@ -1,12 +1,29 @@
 #include "haltech_can.h"
-#include "driver/gpio.h"
-#include "driver/twai.h"
+#include "twai_transport.h"
 #include "screen.h"
 #include "haltech_dash_values_init.h"
+#include "keypad_dictionary.h"
 #include "webpage.h"
+#include "can_id_hash.h"
 #include <unordered_map>
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <strings.h>
 #include "esp_intr_alloc.h"
+#include "esp_timer.h"
 #include "config.h"
+#include "SPIFFS.h"
+
+// Checks the table is indexed by HaltechDisplayType_e, which dashState relies on
+static constexpr bool dashValuesInEnumOrder(uint16_t i = 0)
+{
+  return i == HT_NONE || (dashValues[i].type == i && dashValuesInEnumOrder(i + 1));
+}
+static_assert(sizeof(dashValues) / sizeof(dashValues[0]) == HT_NONE, "dashValues needs one entry per HaltechDisplayType_e");
+static_assert(dashValuesInEnumOrder(), "dashValues must be listed in HaltechDisplayType_e order");
+
+HaltechDashState dashState;
 
 const char* unitDisplayStrings[] = {
     "RPM",       // UNIT_RPM
@@ -15,7 +32,7 @@ const char* unitDisplayStrings[] = {
     "%",         // UNIT_PERCENT
     "Deg",       // UNIT_DEGREES
     "km/h",      // UNIT_KPH
-    "m/s",       // UNIT_MS
+    "ms",        // UNIT_MS
     "Lambda",    // UNIT_LAMBDA
     "Raw",       // UNIT_RAW
     "dB",        // UNIT_DB
@@ -44,421 +61,1368 @@ const char* unitDisplayStrings[] = {
     "MPG",       // UNIT_MPG
     "Foot",      // UNIT_FEET
     "Inch",      // UNIT_INCHES
-    "Mile"       // UNIT_MILES
+    "Mile",      // UNIT_MILES
     "",          // UNIT_NONE
 };
+static_assert(sizeof(unitDisplayStrings) / sizeof(unitDisplayStrings[0]) == UNIT_NONE + 1, "unitDisplayStrings needs one string per HaltechUnit_e");
 
-unsigned long KAinterval = 150;             // 50ms interval for keep aliv frame
-unsigned long ButtonInfoInterval = 30;      // 30ms interval for button info frame
-unsigned long KAintervalMillis = 0;         // storage for millis counter
-unsigned long ButtonInfoIntervalMillis = 0; // storage for millis counter
+static const uint32_t keepAlivePeriodUs = 150000;  // 150ms interval for keep alive frame
+static const uint32_t buttonInfoPeriodUs = 30000;  // 30ms interval for button info frame
 
-float HaltechDashValue::convertToUnit(HaltechUnit_e toUnit)
+// CAN ID dispatch table. Every signal gets an entry, grouped by CAN ID so one
+// frame unpacks all of its signals in a single pass. Groups are found through
+// a perfect hash of the signals' IDs (can_id_hash.h), so an unrelated ID is
+// rejected with a multiply and compare. For the built in signals the hash and layout are
+// searched for at compile time; loading a DBC repeats the search at boot.
+// buildSignalTable() fills in the entries and rebuildDispatchTable() only
+// refreshes which buttons subscribe to each signal.
+#define CAN_STD_ID_COUNT 0x800
+#define NO_DISPATCH_GROUP 0xFF
+
+static_assert(N_BUTTONS <= 16, "CanDispatchEntry::subscribers holds one bit per button");
+static_assert(DASH_VALUE_CAPACITY <= 512, "HaltechDisplayType_e only holds values up to 511");
+static_assert(DASH_VALUE_CAPACITY <= SignalWatchdog::MAX_SIGNALS, "The freshness watchdog tracks every dispatch entry");
+
+// Where a signal sits on the bus and how it's scaled. Built in signals take
+// theirs from dashValues unless a DBC replaces it.
+struct CanSignalFormat
 {
-  // If units are the same, no conversion is needed
-  if (this->incomingUnit == toUnit)
-  {
-    return this->scaled_value;
+  uint16_t canId;
+  uint16_t periodMs;
+  uint8_t startBit;  // can_bits numbering for the byte order
+  uint8_t bitLength;
+  bool littleEndian;
+  bool isSigned;
+  float scale;
+  float offset;
+};
+
+static constexpr CanSignalFormat builtinFormat(const HaltechDashValue &dashValue)
+{
+  CanSignalFormat format = {};
+  format.canId = dashValue.can_id;
+  format.periodMs = dashValue.update_period;
+  CanBitLayout layout = byteFieldLayout(dashValue.start_byte, dashValue.end_byte, dashValue.bitfieldPos);
+  format.startBit = layout.startBit;
+  format.bitLength = layout.length;
+  format.isSigned = dashValue.is_signed;
+  format.scale = dashValue.scale_factor;
+  format.offset = dashValue.offset;
+  return format;
+}
+
+struct CanDispatchGroup
+{
+  uint16_t id;             // CAN_ID_HASH_EMPTY if no signal hashes to this slot
+  uint16_t first;          // Index of the group's first entry in dispatchEntries
+  uint8_t count;
+  uint32_t updatePeriodUs; // Expected frame period, for the jitter histogram
+};
+
+struct CanDispatchLayout
+{
+  CanDispatchGroup groups[CAN_ID_HASH_SLOTS]; // Indexed by hash slot
+  uint16_t entryCount;
+  uint8_t groupCount;
+};
+
+// Count the signals per CAN ID, then lay the groups out contiguously
+static constexpr CanDispatchLayout buildDispatchLayout(CanIdHash hash, const CanSignalFormat *formats, uint16_t count)
+{
+  CanDispatchLayout layout = {};
+  for (CanDispatchGroup &group : layout.groups) {
+    group.id = CAN_ID_HASH_EMPTY;
   }
 
-  switch (this->incomingUnit)
-  {
-  case UNIT_KPA:
-    if (toUnit == UNIT_PSI)
-    {
-      return this->scaled_value * 0.145038; // Convert kPa to PSI
+  for (uint16_t i = 0; i < count; i++) {
+    CanDispatchGroup &group = layout.groups[canIdHashSlot(hash, formats[i].canId)];
+    if (group.id == CAN_ID_HASH_EMPTY) {
+      group.id = formats[i].canId;
+      group.updatePeriodUs = formats[i].periodMs * 1000;
+      layout.groupCount++;
     }
-    else if (toUnit == UNIT_KPA_ABS)
-    {
-      return this->scaled_value + 101.325; // Assuming atmospheric pressure at sea level
+    group.count++;
+  }
+
+  for (CanDispatchGroup &group : layout.groups) {
+    group.first = layout.entryCount;
+    layout.entryCount += group.count;
+  }
+  return layout;
+}
+
+static constexpr bool dashValuesUseStandardIds()
+{
+  for (const HaltechDashValue &dashValue : dashValues) {
+    if (dashValue.can_id >= CAN_STD_ID_COUNT) {
+      return false;
     }
-    else if (toUnit == UNIT_PSI_ABS)
-    {
-      return (this->scaled_value + 101.325) * 0.145038; // kPa gauge to PSI absolute
+  }
+  return true;
+}
+static_assert(dashValuesUseStandardIds(), "The dispatch table only handles standard IDs");
+
+// Periods are in ms. A rate in Hz left in the table would time signals out
+// several times faster than they arrive.
+static constexpr bool dashValuePeriodsFitWatchdog()
+{
+  for (uint16_t i = 0; i < HT_NONE; i++) {
+    if (dashValues[i].update_period < SignalWatchdog::TICK_MS) {
+      return false;
     }
-    break;
+  }
+  return true;
+}
+static_assert(dashValuePeriodsFitWatchdog(), "dashValues update periods must be ms, at least one watchdog tick");
 
-  case UNIT_KPA_ABS:
-    if (toUnit == UNIT_PSI_ABS)
-    {
-      return this->scaled_value * 0.145038; // Convert kPa absolute to PSI absolute
+struct BuiltinFormats
+{
+  CanSignalFormat formats[HT_NONE];
+};
+
+static constexpr BuiltinFormats collectBuiltinFormats()
+{
+  BuiltinFormats builtin = {};
+  for (uint16_t i = 0; i < HT_NONE; i++) {
+    builtin.formats[i] = builtinFormat(dashValues[i]);
+  }
+  return builtin;
+}
+
+// Only evaluated at compile time
+static constexpr BuiltinFormats builtinFormats = collectBuiltinFormats();
+
+// A bit field must end in its end byte; one that stops short, or runs past
+// it, was given the wrong length
+static constexpr bool builtinBitFieldsFitTheirBytes()
+{
+  for (uint16_t i = 0; i < HT_NONE; i++) {
+    if (dashValues[i].bitfieldPos == HT_NO_BIT) {
+      continue;
     }
-    else if (toUnit == UNIT_KPA)
-    {
-      return this->scaled_value - 101.325; // Subtract atmospheric pressure to get kPa gauge
+    const CanSignalFormat &format = builtinFormats.formats[i];
+    if (signalLastByte(format.startBit, format.bitLength) != dashValues[i].end_byte ||
+        dashValues[i].end_byte > 7) {
+      return false;
     }
-    else if (toUnit == UNIT_PSI)
-    {
-      return (this->scaled_value - 101.325) * 0.145038; // kPa absolute to PSI gauge
+  }
+  return true;
+}
+static_assert(builtinBitFieldsFitTheirBytes(), "A signal's bitfieldPos must end in its end byte");
+static constexpr CanIdHash builtinHash = findCanIdHash(builtinFormats.formats, HT_NONE);
+static_assert(builtinHash.multiplier != 0, "No perfect hash for the CAN IDs in dashValues, raise CAN_ID_HASH_BITS");
+static constexpr CanDispatchLayout builtinLayout = buildDispatchLayout(builtinHash, builtinFormats.formats, HT_NONE);
+static_assert(builtinLayout.entryCount == HT_NONE, "Every signal needs a dispatch entry");
+
+// The active hash and layout, built in until a DBC is loaded. Constant
+// initialised, and in DRAM with the entries so the CAN task's lookups don't
+// go through flash.
+static CanIdHash canIdHash = builtinHash;
+static CanDispatchLayout dispatchLayout = builtinLayout;
+static CanDispatchEntry dispatchEntries[DASH_VALUE_CAPACITY];
+static uint16_t entryForSignal[DASH_VALUE_CAPACITY];
+
+// Hash slot of the dispatch group for a standard ID, or NO_DISPATCH_GROUP
+static inline uint8_t dispatchGroupFor(uint32_t id)
+{
+  uint8_t slot = canIdHashSlot(canIdHash, id);
+  return dispatchLayout.groups[slot].id == id ? slot : NO_DISPATCH_GROUP;
+}
+
+// Signals added by SIGNAL_DBC_FILE
+static HaltechDashValue customValues[DBC_MAX_CUSTOM_SIGNALS];
+static char customNames[DBC_MAX_CUSTOM_SIGNALS][DBC_NAME_LENGTH];
+static uint16_t customValueCount = 0;
+
+uint16_t dashValueCount()
+{
+  return HT_NONE + customValueCount;
+}
+
+const HaltechDashValue* dashValueAt(uint16_t index)
+{
+  if (index < HT_NONE) {
+    return &dashValues[index];
+  }
+  if (index < HT_NONE + customValueCount) {
+    return &customValues[index - HT_NONE];
+  }
+  return nullptr;
+}
+
+// A DBC file can give a built in signal a different cycle time, which only
+// the dispatch table knows about
+uint16_t HaltechDashValue::updatePeriod() const
+{
+  return dispatchEntries[entryForSignal[type]].periodMs;
+}
+
+// Per CAN ID reception statistics, indexed like dispatchLayout.groups
+static CanIdStats idStats[CAN_ID_HASH_SLOTS];
+
+// Upper bounds (us) of the jitter histogram buckets; the last bucket is open
+static const int32_t jitterBucketLimits[CAN_JITTER_BUCKETS - 1] = {-5000, -1000, -250, 250, 1000, 5000, 20000};
+static const char* jitterBucketLabels[CAN_JITTER_BUCKETS] = {"<-5ms", "-5..-1", "-1..-.25", "+-.25", ".25..1", "1..5", "5..20", ">20ms"};
+
+#define STD_ID_BITS 0x7FF
+#define MAX_FILTER_IDS (DASH_VALUE_CAPACITY + KEYPAD_COUNT) // Every signal's ID plus the keypads' SDO requests
+
+static const uint8_t keypadNodeIds[] = KEYPAD_NODE_IDS;
+static_assert(sizeof(keypadNodeIds) == KEYPAD_COUNT, "KEYPAD_COUNT must match KEYPAD_NODE_IDS");
+static_assert(KEYPAD_COUNT <= 8, "Pending button edges are tracked in a byte");
+static_assert(KEYPAD_BUTTONS_PER_NODE <= 16, "The keypad button frame holds 16 buttons");
+
+// Index of the keypad a standard ID is an SDO request for, or -1
+static int8_t keypadForRequestId(uint32_t id)
+{
+  for (uint8_t keypad = 0; keypad < KEYPAD_COUNT; keypad++) {
+    if (id == 0x600u + keypadNodeIds[keypad]) {
+      return keypad;
     }
-    break;
+  }
+  return -1;
+}
 
-  case UNIT_K:
-    if (toUnit == UNIT_CELSIUS)
-    {
-      return this->scaled_value - 273.15; // Kelvin to Celsius
+// Standard IDs the acceptance filter was last built from. Written under
+// driverLock, see updateAcceptanceFilter().
+static uint16_t filterIds[MAX_FILTER_IDS];
+static uint16_t filterIdCount = 0;
+
+static TwaiTransport twaiTransport(CAN_TX_PIN, CAN_RX_PIN);
+
+// Number of standard IDs matched by a filter with the given don't-care bits
+static uint16_t filterCoverage(uint16_t dontCare)
+{
+  return 1 << __builtin_popcount(dontCare & STD_ID_BITS);
+}
+
+// Smallest code/mask pair covering ids[first..last)
+static void filterFor(const uint16_t *ids, uint16_t first, uint16_t last, uint16_t &code, uint16_t &dontCare)
+{
+  uint16_t allAnd = STD_ID_BITS, allOr = 0;
+  for (uint16_t i = first; i < last; i++) {
+    allAnd &= ids[i];
+    allOr |= ids[i];
+  }
+  code = allAnd;
+  dontCare = allAnd ^ allOr;
+}
+
+// Pick the single or dual TWAI filter configuration that lets the fewest
+// unused standard IDs through. Dual filter candidates split the sorted ID list
+// at every position and on every ID bit; the overlap between the two filters
+// is subtracted so the accepted count is exact.
+static CanAcceptanceFilter computeAcceptanceFilter(const uint16_t *ids, uint16_t count)
+{
+  CanAcceptanceFilter best;
+  uint16_t code, dontCare;
+  filterFor(ids, 0, count, code, dontCare);
+  best.single = true;
+  best.code = (uint32_t)code << 21;
+  best.mask = ((uint32_t)dontCare << 21) | 0x1FFFFF; // Ignore RTR and data bytes
+  best.acceptedIdCount = filterCoverage(dontCare);
+
+  static uint16_t sorted[MAX_FILTER_IDS], groupA[MAX_FILTER_IDS], groupB[MAX_FILTER_IDS];
+  memcpy(sorted, ids, count * sizeof(ids[0]));
+  std::sort(sorted, sorted + count);
+
+  for (uint16_t candidate = 1; candidate < count + 11; candidate++) {
+    uint16_t countA = 0, countB = 0;
+    for (uint16_t i = 0; i < count; i++) {
+      bool inA = candidate < count ? i < candidate : !(sorted[i] & (1 << (candidate - count)));
+      if (inA) {
+        groupA[countA++] = sorted[i];
+      } else {
+        groupB[countB++] = sorted[i];
+      }
     }
-    else if (toUnit == UNIT_FAHRENHEIT)
-    {
-      return (this->scaled_value - 273.15) * 9.0 / 5.0 + 32.0; // Kelvin to Fahrenheit
-    }
-    break;
-
-  case UNIT_CC:
-    if (toUnit == UNIT_GALLONS) {
-      return this->scaled_value / 3785.41; // Convert cubic centimeters to US gallons (1 gallon = 3785.41 cc)
-    }
-    break;
-
-  case UNIT_KPH:
-    if (toUnit == UNIT_MPH) {
-      return this->scaled_value * 0.621371; // Convert KPH to MPH
-    }
-    break;
-
-  case UNIT_RPM:
-    break;
-  case UNIT_PERCENT:
-    break;
-  case UNIT_DEGREES:
-    break;
-  case UNIT_MS:
-    if (toUnit == UNIT_SECONDS) {
-        return this->scaled_value / 1000.0; // Convert milliseconds to seconds
-    }
-    break;
-  case UNIT_LAMBDA:
-    if (toUnit == UNIT_AFR) {
-        return this->scaled_value * 14.7; // Convert lambda to AFR (assuming stoichiometric value for gasoline is 14.7)
-    }
-    break;
-  case UNIT_RAW:
-    break;
-  case UNIT_DB:
-    break;
-  case UNIT_MPS2:
-    break;
-  case UNIT_BOOLEAN:
-    break;
-  case UNIT_CCPM:
-    break;
-  case UNIT_VOLTS:
-    break;
-  case UNIT_PPM:
-    break;
-  case UNIT_GPM3:
-    break;
-  case UNIT_LITERS:
-    break;
-  case UNIT_SECONDS:
-    break;
-  case UNIT_ENUM:
-    break;
-  case UNIT_MM:
-    if (toUnit == UNIT_INCHES) {
-        return this->scaled_value / 25.4; // Convert millimeters to inches
-    }
-    break;
-  case UNIT_BIT_FIELD:
-    break;
-  case UNIT_METERS:
-    if (toUnit == UNIT_MILES) {
-        return this->scaled_value * 0.000621371; // Convert meters to miles
-    } else if (toUnit == UNIT_FEET) {
-        return this->scaled_value * 3.28084; // Convert meters to feet
-    }
-    break;
-  }
-
-  Serial.printf("Add %s to %s for %s\n", unitDisplayStrings[this->incomingUnit], unitDisplayStrings[toUnit], this->short_name);
-  return this->scaled_value;
+    if (countA == 0 || countB == 0) {
+      continue;
+    }
+
+    uint16_t codeA, dontCareA, codeB, dontCareB;
+    filterFor(groupA, 0, countA, codeA, dontCareA);
+    filterFor(groupB, 0, countB, codeB, dontCareB);
+
+    uint16_t accepted = filterCoverage(dontCareA) + filterCoverage(dontCareB);
+    uint16_t caredByBoth = ~dontCareA & ~dontCareB & STD_ID_BITS;
+    if (((codeA ^ codeB) & caredByBoth) == 0) {
+      accepted -= filterCoverage(dontCareA & dontCareB);
+    }
+
+    if (accepted < best.acceptedIdCount) {
+      best.single = false;
+      best.acceptedIdCount = accepted;
+      // Filter 1 also spans RTR and the first data byte, filter 2 spans RTR
+      best.code = ((uint32_t)codeA << 21) | ((uint32_t)codeB << 5);
+      best.mask = ((uint32_t)dontCareA << 21) | 0x1F000F | ((uint32_t)dontCareB << 5) | 0x10;
+    }
+  }
+
+  return best;
+}
+
+// Map the default dashboard values to their webpage slot and precision
+static uint8_t webpageIndexFor(HaltechDisplayType_e displayType, int8_t &decimals)
+{
+  switch(displayType) {
+    case HT_MANIFOLD_PRESSURE: decimals = 2; return 0;
+    case HT_RPM: decimals = 0; return 1;
+    case HT_THROTTLE_POSITION: decimals = 0; return 2;
+    case HT_COOLANT_TEMPERATURE: decimals = 1; return 3;
+    case HT_OIL_PRESSURE: decimals = 1; return 4;
+    case HT_OIL_TEMPERATURE: decimals = 1; return 5;
+    case HT_WIDEBAND_OVERALL: decimals = 2; return 6;
+    case HT_AIR_TEMPERATURE: decimals = 1; return 7;
+    case HT_BOOST_CONTROL_OUTPUT: decimals = 0; return 8;
+    case HT_TARGET_BOOST_LEVEL: decimals = 1; return 9;
+    case HT_IGNITION_ANGLE: decimals = 1; return 10;
+    case HT_BATTERY_VOLTAGE: decimals = 2; return 11;
+    case HT_INTAKE_CAM_ANGLE_1: decimals = 1; return 12;
+    case HT_VEHICLE_SPEED: decimals = 1; return 13;
+    case HT_TOTAL_FUEL_USED: decimals = 4; return 14;
+    case HT_KNOCK_LEVEL_1: decimals = 2; return 15;
+    default: return 255;
+  }
 }
 
 HaltechCan::HaltechCan()
+    : transport(&twaiTransport), driverLock(xSemaphoreCreateMutex())
+{
+  replay.active = false;
+  replay.haveFrame = false;
+  for (uint8_t keypad = 0; keypad < KEYPAD_COUNT; keypad++) {
+    keypads[keypad].begin(keypadNodeIds[keypad], keypad, keypadDictionary, KEYPAD_OBJECT_COUNT);
+  }
+  txScheduler.setRefresh(refreshButtonInfo, this);
+  buildSignalTable();
+}
+
+void HaltechCan::buildSignalTable(const CanSignalFormat *formats)
+{
+  uint8_t filled[CAN_ID_HASH_SLOTS] = {};
+
+  for (uint16_t i = 0; i < dashValueCount(); i++)
+  {
+    const HaltechDashValue* dashValue = dashValueAt(i);
+    CanSignalFormat format = formats != nullptr ? formats[i] : builtinFormat(*dashValue);
+    uint8_t groupIndex = dispatchGroupFor(format.canId);
+    uint16_t entryIndex = dispatchLayout.groups[groupIndex].first + filled[groupIndex]++;
+    CanDispatchEntry* entry = &dispatchEntries[entryIndex];
+    entryForSignal[i] = entryIndex;
+    entry->dashValue = dashValue;
+    entry->signal = i;
+    entry->scale = format.scale;
+    entry->offset = format.offset;
+    entry->periodMs = format.periodMs;
+    entry->isSigned = format.isSigned;
+    entry->littleEndian = format.littleEndian;
+    entry->startBit = format.startBit;
+    entry->bitLength = format.bitLength;
+    entry->decode = specializedDecoder(entry->startBit, entry->bitLength,
+                                       entry->littleEndian ? CAN_LITTLE_ENDIAN : CAN_BIG_ENDIAN, entry->isSigned);
+    entry->subscribers = 0;
+    entry->webpageDecimals = 0;
+    entry->webpageIndex = webpageIndexFor(dashValue->type, entry->webpageDecimals);
+  }
+}
+
+// Built in signal a DBC signal name refers to, or HT_NONE. Matches the short
+// name, or the long name with spaces written as underscores.
+static uint16_t builtinSignalNamed(const char *name)
+{
+  for (uint16_t i = 0; i < HT_NONE; i++) {
+    if (strcmp(name, dashValues[i].short_name) == 0) {
+      return i;
+    }
+
+    const char *dbcName = name;
+    const char *longName = dashValues[i].name;
+    while (*dbcName != '\0' && (*dbcName == *longName || (*dbcName == '_' && *longName == ' '))) {
+      dbcName++;
+      longName++;
+    }
+    if (*dbcName == '\0' && *longName == '\0') {
+      return i;
+    }
+  }
+  return HT_NONE;
+}
+
+// Unit strings as DBC files write them, which aren't the ones the dash
+// shows. Units with no HaltechUnit_e, such as m/s, are left out.
+static const struct {
+  const char *dbcUnit;
+  HaltechUnit_e unit;
+} dbcUnits[] = {
+  {"rpm",     UNIT_RPM},
+  {"kPa",     UNIT_KPA},
+  {"kPa abs", UNIT_KPA_ABS},
+  {"kPaA",    UNIT_KPA_ABS},
+  {"%",       UNIT_PERCENT},
+  {"deg",     UNIT_DEGREES},
+  {"km/h",    UNIT_KPH},
+  {"kph",     UNIT_KPH},
+  {"ms",      UNIT_MS},
+  {"s",       UNIT_SECONDS},
+  {"lambda",  UNIT_LAMBDA},
+  {"dB",      UNIT_DB},
+  {"m/s^2",   UNIT_MPS2},
+  {"m/s2",    UNIT_MPS2},
+  {"cc/min",  UNIT_CCPM},
+  {"V",       UNIT_VOLTS},
+  {"K",       UNIT_K},
+  {"ppm",     UNIT_PPM},
+  {"g/m^3",   UNIT_GPM3},
+  {"L",       UNIT_LITERS},
+  {"mm",      UNIT_MM},
+  {"cc",      UNIT_CC},
+  {"m",       UNIT_METERS},
+  {"deg/s",   UNIT_DEG_S},
+  {"psi",     UNIT_PSI},
+  {"psia",    UNIT_PSI_ABS},
+  {"AFR",     UNIT_AFR},
+  {"degC",    UNIT_CELSIUS},
+  {"C",       UNIT_CELSIUS},
+  {"degF",    UNIT_FAHRENHEIT},
+  {"F",       UNIT_FAHRENHEIT},
+  {"mph",     UNIT_MPH},
+  {"gal",     UNIT_GALLONS},
+  {"mpg",     UNIT_MPG},
+  {"ft",      UNIT_FEET},
+  {"in",      UNIT_INCHES},
+  {"mi",      UNIT_MILES},
+};
+
+static HaltechUnit_e unitFromDbc(const char *unit, uint8_t bitLength)
+{
+  for (const auto &dbcUnit : dbcUnits) {
+    if (strcasecmp(unit, dbcUnit.dbcUnit) == 0) {
+      return dbcUnit.unit;
+    }
+  }
+  return bitLength == 1 ? UNIT_BOOLEAN : UNIT_RAW;
+}
+
+// Scratch space for loadSignalDefinitions(), only allocated while loading
+struct SignalLoadScratch
+{
+  CanSignalFormat formats[DASH_VALUE_CAPACITY];
+  bool fromDbc[DASH_VALUE_CAPACITY];
+  HaltechDashValue customValues[DBC_MAX_CUSTOM_SIGNALS];
+  char customNames[DBC_MAX_CUSTOM_SIGNALS][DBC_NAME_LENGTH];
+  char line[256];
+};
+
+// Replaces and adds signals from a DBC file. The dispatch table is rebuilt
+// with a new perfect hash, so decoding costs the same as for the built in
+// signals. If anything goes wrong the built in table is left as it was.
+bool HaltechCan::loadSignalDefinitions(const char *path)
+{
+  if (rxTaskHandle != nullptr) {
+    Serial.printf("Signal definitions can only be loaded before the CAN task starts\n");
+    return false;
+  }
+
+  if (!SPIFFS.begin(true) || !SPIFFS.exists(path)) {
+    Serial.printf("No %s, using the built in signals\n", path);
+    return false;
+  }
+
+  File file = SPIFFS.open(path, FILE_READ);
+  if (!file) {
+    Serial.printf("Failed to open %s\n", path);
+    return false;
+  }
+
+  std::unique_ptr<SignalLoadScratch> scratch(new (std::nothrow) SignalLoadScratch);
+  if (!scratch) {
+    Serial.printf("Not enough memory to load %s\n", path);
+    file.close();
+    return false;
+  }
+
+  int64_t startUs = esp_timer_get_time();
+  for (uint16_t i = 0; i < HT_NONE; i++) {
+    scratch->formats[i] = builtinFormat(dashValues[i]);
+    scratch->fromDbc[i] = false;
+  }
+
+  uint16_t customCount = 0;
+  uint16_t replacedCount = 0;
+  uint16_t skippedCount = 0;
+  uint32_t lineCount = 0;
+  uint32_t messageId = 0;
+  bool messageUsable = false;
+
+  while (file.available()) {
+    size_t length = file.readBytesUntil('\n', scratch->line, sizeof(scratch->line) - 1);
+    scratch->line[length] = '\0';
+    lineCount++;
+
+    uint32_t id;
+    bool extended;
+    uint16_t periodMs;
+    DbcSignal dbcSignal;
+    if (parseDbcMessage(scratch->line, id, extended)) {
+      messageId = id;
+      messageUsable = !extended && id < CAN_STD_ID_COUNT;
+      if (!messageUsable) {
+        Serial.printf("  Skipping message %X, only standard IDs are decoded\n", id);
+      }
+    } else if (parseDbcSignal(scratch->line, dbcSignal)) {
+      if (!messageUsable) {
+        skippedCount++;
+        continue;
+      }
+
+      uint16_t signal = builtinSignalNamed(dbcSignal.name);
+      if (signal != HT_NONE) {
+        replacedCount++;
+      } else if (customCount < DBC_MAX_CUSTOM_SIGNALS) {
+        signal = HT_NONE + customCount;
+        strcpy(scratch->customNames[customCount], dbcSignal.name);
+
+        HaltechDashValue &custom = scratch->customValues[customCount];
+        custom = {};
+        custom.type = (HaltechDisplayType_e)signal;
+        custom.can_id = messageId;
+        custom.start_byte = dbcSignal.startBit / 8;
+        custom.end_byte = signalLastByte(dbcSignal.startBit, dbcSignal.length);
+        custom.incomingUnit = unitFromDbc(dbcSignal.unit, dbcSignal.length);
+        custom.scale_factor = dbcSignal.scale;
+        custom.offset = dbcSignal.offset;
+        custom.is_signed = dbcSignal.isSigned;
+        custom.bitfieldPos = HT_NO_BIT; // Decoded from its DBC format
+        customCount++;
+      } else {
+        Serial.printf("  Skipping %s, only %u signals can be added\n", dbcSignal.name, DBC_MAX_CUSTOM_SIGNALS);
+        skippedCount++;
+        continue;
+      }
+
+      CanSignalFormat &format = scratch->formats[signal];
+      format.canId = messageId;
+      format.periodMs = 0; // Until a GenMsgCycleTime says otherwise
+      format.startBit = dbcSignal.startBit;
+      format.bitLength = dbcSignal.length;
+      format.littleEndian = dbcSignal.order == CAN_LITTLE_ENDIAN;
+      format.isSigned = dbcSignal.isSigned;
+      format.scale = dbcSignal.scale;
+      format.offset = dbcSignal.offset;
+      scratch->fromDbc[signal] = true;
+    } else if (parseDbcCycleTime(scratch->line, id, extended, periodMs)) {
+      for (uint16_t i = 0; i < HT_NONE + customCount; i++) {
+        if (scratch->fromDbc[i] && !extended && scratch->formats[i].canId == id) {
+          scratch->formats[i].periodMs = periodMs;
+        }
+      }
+    } else if (strstr(scratch->line, "SG_ ") != nullptr) {
+      skippedCount++; // Multiplexed, or a layout can_bits can't extract
+    }
+  }
+  file.close();
+
+  uint16_t count = HT_NONE + customCount;
+  for (uint16_t i = 0; i < count; i++) {
+    if (scratch->fromDbc[i] && scratch->formats[i].periodMs == 0) {
+      scratch->formats[i].periodMs = DBC_DEFAULT_PERIOD_MS;
+    }
+  }
+
+  CanIdHash hash = findCanIdHash(scratch->formats, count);
+  if (hash.multiplier == 0) {
+    Serial.printf("No perfect hash for the CAN IDs in %s, using the built in signals\n", path);
+    return false;
+  }
+
+  for (uint16_t i = 0; i < customCount; i++) {
+    memcpy(customNames[i], scratch->customNames[i], DBC_NAME_LENGTH);
+    customValues[i] = scratch->customValues[i];
+    customValues[i].name = customNames[i];
+    customValues[i].short_name = customNames[i];
+    customValues[i].update_period = scratch->formats[HT_NONE + i].periodMs;
+  }
+  customValueCount = customCount;
+
+  canIdHash = hash;
+  dispatchLayout = buildDispatchLayout(hash, scratch->formats, count);
+  buildSignalTable(scratch->formats);
+
+  Serial.printf("Loaded %s in %lu us: %u lines, %u built in signals replaced, %u added, %u skipped\n",
+                path, (unsigned long)(esp_timer_get_time() - startUs), lineCount, replacedCount, customCount, skippedCount);
+  Serial.printf("  %u signals across %u CAN IDs, hash multiplier %u shift %u. %u B of dispatch entries, %u B for added signals\n",
+                count, dispatchLayout.groupCount, hash.multiplier, hash.shift,
+                count * sizeof(CanDispatchEntry), customCount * (sizeof(HaltechDashValue) + DBC_NAME_LENGTH));
+  return true;
+}
+
+void HaltechCan::rebuildDispatchTable()
+{
+  for (uint16_t entryIndex = 0; entryIndex < dispatchLayout.entryCount; entryIndex++)
+  {
+    dispatchEntries[entryIndex].subscribers = 0;
+  }
+
+  uint8_t subscribedCount = 0;
+  for (int buttonIndex = 0; buttonIndex < N_BUTTONS; buttonIndex++)
+  {
+    const HaltechDashValue* dashValue = htButtons[buttonIndex].dashValue;
+    if (dashValue == nullptr) {
+      continue;
+    }
+
+    // A DBC may have moved the signal, so don't go by dashValue->can_id
+    dispatchEntries[entryForSignal[dashValue->type]].subscribers |= 1 << buttonIndex;
+    subscribedCount++;
+  }
+
+  Serial.printf("Dispatch table: %u signals across %u CAN IDs, %u button subscriptions\n", dispatchLayout.entryCount, dispatchLayout.groupCount, subscribedCount);
+
+  updateAcceptanceFilter();
+}
+
+void HaltechCan::updateAcceptanceFilter()
+{
+  // Built aside and published under driverLock, as the CAN task reads the
+  // filter when it reinstalls the driver. Only the UI loop writes it.
+  static uint16_t ids[MAX_FILTER_IDS];
+  uint16_t idCount = 0;
+  for (uint16_t id = 0; id < CAN_STD_ID_COUNT && idCount < MAX_FILTER_IDS; id++) {
+    if (dispatchGroupFor(id) != NO_DISPATCH_GROUP || keypadForRequestId(id) >= 0) {
+      ids[idCount++] = id;
+    }
+  }
+
+  CanAcceptanceFilter filter = computeAcceptanceFilter(ids, idCount);
+  if (discoveryMode) {
+    // Everything through, so unknown IDs show up in the discovery table
+    filter = {0, 0xFFFFFFFF, true, CAN_STD_ID_COUNT};
+  }
+  bool idsChanged = idCount != filterIdCount || memcmp(ids, filterIds, idCount * sizeof(ids[0])) != 0;
+  if (!idsChanged && filter.code == acceptanceFilter.code && filter.mask == acceptanceFilter.mask && filter.single == acceptanceFilter.single) {
+    return;
+  }
+
+  xSemaphoreTake(driverLock, portMAX_DELAY);
+  memcpy(filterIds, ids, idCount * sizeof(ids[0]));
+  filterIdCount = idCount;
+  acceptanceFilter = filter;
+  xSemaphoreGive(driverLock);
+
+  Serial.printf("Acceptance filter: %s, code 0x%08x, mask 0x%08x, %u IDs pass the filter, %u in use\n",
+                filter.single ? "single" : "dual", filter.code, filter.mask, filter.acceptedIdCount, idCount);
+
+  // The driver must be reinstalled to change filters; let the CAN task do it
+  // between reads so it never blocks on a driver that's going away
+  if (rxTaskHandle != nullptr) {
+    filterReinstallPending = true;
+  }
+}
+
+void HaltechCan::printDecodeStats(Print &out)
+{
+  unsigned long now = millis();
+  unsigned long elapsed = now - lastStatsPrintTime;
+  uint32_t decodedFrames = decodedFrameCount.load(std::memory_order_relaxed);
+  uint32_t rejectedFrames = rejectedFrameCount.load(std::memory_order_relaxed);
+  uint32_t decodedSignals = decodedSignalCount.load(std::memory_order_relaxed);
+  uint32_t decodeUs = decodeTimeUs.load(std::memory_order_relaxed);
+  uint32_t frames = decodedFrames + rejectedFrames;
+
+  out.printf("CAN decode: %u frames (%u decoded, %u rejected in software), %u signals in %lu ms\n", frames, decodedFrames, rejectedFrames, decodedSignals, elapsed);
+  if (elapsed > 0 && frames > 0) {
+    out.printf("  %.1f frames/s, %.2f us/frame (%.0f cycles), %.3f%% CPU\n",
+               frames * 1000.0f / elapsed,
+               (float)decodeUs / frames,
+               (float)decodeUs * getCpuFrequencyMhz() / frames,
+               decodeUs / (elapsed * 10.0f));
+  }
+  out.printf("  Signal table: %u B of metadata in flash, %u B of state and %u B of dispatch entries in RAM\n",
+             sizeof(dashValues), sizeof(dashState), dispatchLayout.entryCount * sizeof(CanDispatchEntry));
+
+  CanTransportStatus status;
+  bool haveStatus = lockedTransportStatus(status);
+  out.printf("  Update queue: %u/%u peak, %u dropped. RX queue: %u peak, %u full events\n",
+             updateQueue.highWaterMark(), updateQueue.capacity(), updateQueue.dropCount(), rxQueuePeak.load(std::memory_order_relaxed), haveStatus ? status.rxQueueFullEvents : 0);
+  if (haveStatus) {
+    out.printf("  RX missed: %u, overrun: %u\n", status.rxMissed, status.rxOverrun);
+  }
+
+  out.printf("  Acceptance filter (%s): %u/%u standard IDs pass, %.1f%% of the ID space rejected in hardware\n",
+             acceptanceFilter.single ? "single" : "dual", acceptanceFilter.acceptedIdCount, CAN_STD_ID_COUNT,
+             100.0f * (CAN_STD_ID_COUNT - acceptanceFilter.acceptedIdCount) / CAN_STD_ID_COUNT);
+  if (frames > 0) {
+    out.printf("  %.1f%% of frames passing the hardware filter were rejected in software\n", 100.0f * rejectedFrames / frames);
+  }
+
+}
+
+// Starts a new measurement window for printDecodeStats(). The CAN task,
+// which writes the counters, zeroes them the next time round its loop.
+void HaltechCan::resetDecodeStats()
+{
+  decodeStatsResetPending = true;
+  lastStatsPrintTime = millis();
+}
+
+void HaltechCan::printTxStats(Print &out)
+{
+  static const char *priorityNames[CAN_TX_PRIORITY_COUNT] = {"SDO", "Periodic"};
+
+  for (uint8_t priority = 0; priority < CAN_TX_PRIORITY_COUNT; priority++) {
+    const CanTxStats &stats = txScheduler.stats((CanTxPriority_e)priority);
+    out.printf("CAN TX %-8s: %u sent, %u dropped, %u coalesced, %u missed deadlines, latency %u/%u/%u us min/avg/max\n",
+               priorityNames[priority], stats.sent, stats.dropped, stats.coalesced, stats.missedDeadlines,
+               stats.minLatencyUs, stats.sent ? (uint32_t)(stats.totalLatencyUs / stats.sent) : 0, stats.maxLatencyUs);
+  }
+
+  CanTransportStatus status;
+  if (lockedTransportStatus(status)) {
+    out.printf("  TX failed: %u, bus-off events: %u%s\n", status.txFailed, status.busOffCount, status.busOff ? " (bus-off now)" : "");
+  }
+
+  const CanLatencyStats *edgeStats[2] = {&buttonEdgeHandoffLatency, &buttonEdgeWireLatency};
+  const char *edgeStatNames[2] = {"to controller", "on the wire"};
+  for (uint8_t i = 0; i < 2; i++) {
+    const CanLatencyStats *stats = edgeStats[i];
+    out.printf("  Button edge, touch sample %-13s: %u edges, %u/%u/%u us min/avg/max\n", edgeStatNames[i], stats->count,
+               stats->minUs, stats->count ? (uint32_t)(stats->totalUs / stats->count) : 0, stats->maxUs);
+  }
+}
+
+void HaltechCan::setDiscoveryMode(bool enabled)
+{
+  discoveryMode = enabled;
+  updateAcceptanceFilter();
+}
+
+void HaltechCan::printUnknownIds(Print &out)
+{
+  static UnknownIdEntry entries[UnknownIdTable::CAPACITY];
+  uint16_t count = unknownIds.snapshot(entries, UnknownIdTable::CAPACITY);
+
+  out.printf("Unknown CAN IDs: %u seen, %u not tracked (no room in the table), discovery mode %s\n",
+             unknownIds.size(), unknownIds.overflowCount(), discoveryMode ? "on" : "off");
+  out.printf("      ID     Count   Rate Hz  Payload (* = byte has changed)\n");
+  for (uint16_t i = 0; i < count; i++) {
+    const UnknownIdEntry &entry = entries[i];
+    out.printf(entry.extended ? "%08X" : "     %03X", entry.id);
+    out.printf(" %9u %9.1f ", entry.count, entry.rateHz());
+    for (uint8_t byteIndex = 0; byteIndex < entry.len; byteIndex++) {
+      out.printf(" %02X%c", entry.data[byteIndex], (entry.changedBytes & (1 << byteIndex)) ? '*' : ' ');
+    }
+    out.printf("\n");
+  }
+}
+
+void HaltechCan::printIdStats(Print &out)
 {
+  out.printf("  ID  Period    Frames     Bytes  Drops   Min us   Avg us   Max us |");
+  for (uint8_t bucket = 0; bucket < CAN_JITTER_BUCKETS; bucket++) {
+    out.printf(" %8s", jitterBucketLabels[bucket]);
+  }
+  out.printf("\n");
+
+  for (uint16_t id = 0; id < CAN_STD_ID_COUNT; id++) {
+    uint8_t groupIndex = dispatchGroupFor(id);
+    if (groupIndex == NO_DISPATCH_GROUP) {
+      continue;
+    }
+
+    // Copy first so the CAN task can keep updating while we print
+    CanIdStats stats = idStats[groupIndex];
+    uint32_t intervals = stats.frames > 1 ? stats.frames - 1 : 0;
+    out.printf("%03X %5lums %9u %9u %6u %8u %8u %8u |", id,
+               dispatchLayout.groups[groupIndex].updatePeriodUs / 1000,
+               stats.frames, stats.bytes, stats.drops, stats.minIntervalUs,
+               intervals ? (uint32_t)(stats.totalIntervalUs / intervals) : 0, stats.maxIntervalUs);
+    for (uint8_t bucket = 0; bucket < CAN_JITTER_BUCKETS; bucket++) {
+      out.printf(" %8u", stats.jitter[bucket]);
+    }
+    out.printf("\n");
+  }
+}
+
+void HaltechCan::useTransport(CanTransport &canTransport)
+{
+  transport = &canTransport;
 }
 
 bool HaltechCan::begin(long baudRate)
 {
     //delay(1000);
 
-    // First, uninstall any existing driver
-    twai_driver_uninstall();
-    
-    twai_general_config_t g_config = TWAI_GENERAL_CONFIG_DEFAULT(CAN_TX_PIN, CAN_RX_PIN, TWAI_MODE_NORMAL);
+    bitrate = baudRate;
+    updateAcceptanceFilter();
+    if (!installDriver()) {
+        return false;
+    }
 
-    // Enable RX data alerts
-    g_config.alerts_enabled = TWAI_ALERT_RX_DATA | TWAI_ALERT_RX_QUEUE_FULL;
-    g_config.rx_queue_len = 100;
-    
-    twai_timing_config_t t_config = TWAI_TIMING_CONFIG_1MBITS();
-    twai_filter_config_t f_config = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+    if (rxTaskHandle == nullptr) {
+        int64_t now = esp_timer_get_time();
+        keepAliveTx = txScheduler.addPeriodic(keepAlivePeriodUs, now);
+        buttonInfoTx = txScheduler.addPeriodic(buttonInfoPeriodUs, now);
 
-    // Install TWAI driver
-    esp_err_t install_err = twai_driver_install(&g_config, &t_config, &f_config);
-    if (install_err != ESP_OK) {
-        Serial.printf("Failed to install driver. Error code: 0x%x\n", install_err);
-        return false;
+        // Give every signal a deadline from the start, so one the ECU never
+        // sends (or an ECU that's off) goes stale rather than showing 0
+        unsigned long nowMs = millis();
+        for (uint16_t entryIndex = 0; entryIndex < dispatchLayout.entryCount; entryIndex++) {
+            freshness.refresh(entryIndex, nowMs, dispatchEntries[entryIndex].periodMs * STALE_TIMEOUT_MULTIPLIER);
+        }
     }
 
-    // Start TWAI driver
-    if (twai_start() == ESP_OK) {
-        Serial.printf("Driver started\n");
-    } else {
-        Serial.printf("Failed to start driver\n");
-        twai_driver_uninstall();
+    if (rxTaskHandle == nullptr &&
+        xTaskCreatePinnedToCore(rxTask, "can_rx", CAN_TASK_STACK_SIZE, this, CAN_TASK_PRIORITY, &rxTaskHandle, CAN_TASK_CORE) != pdPASS) {
+        Serial.printf("Failed to create CAN task\n");
         return false;
     }
 
     return true;
 }
 
-uint32_t HaltechCan::extractValue(const uint8_t *buffer, uint8_t start_byte, uint8_t end_byte, bool is_signed)
+// The UI core sends button edges straight to the transport, so it must not
+// find the driver half torn down
+bool HaltechCan::installDriver()
 {
-    uint32_t result = 0;
-    uint8_t num_bytes = end_byte - start_byte + 1;
-    
-    // Extract the value
-    for (int i = start_byte; i <= end_byte; i++)
-    {
-        result = (result << 8) | buffer[i];
-    }
-    
-    // Handle sign extension if needed
-    if (is_signed)
-    {
-        // Calculate number of bits in the value
-        uint8_t num_bits = num_bytes * 8;
-        
-        // Check if the highest bit is set (negative number)
-        if (result & (1UL << (num_bits - 1)))
-        {
-            // Create a mask for sign extension
-            uint32_t mask = 0xFFFFFFFF << num_bits;
-            
-            // Apply sign extension
-            result |= mask;
-        }
-    }
-    
-    return result;
+    xSemaphoreTake(driverLock, portMAX_DELAY);
+    bool installed = transport->begin(bitrate, acceptanceFilter, filterIds, filterIdCount);
+    xSemaphoreGive(driverLock);
+    return installed;
 }
 
-void HaltechCan::process(const unsigned long preemptLimit)
+// For the UI core, which can't touch the transport while it's reinstalled
+bool HaltechCan::lockedTransportStatus(CanTransportStatus &status)
 {
-  uint32_t alerts;
-  twai_message_t message;
-
-  // Wait for alert
-  if (twai_read_alerts(&alerts, pdMS_TO_TICKS(10)) == ESP_OK) {
-      if (alerts & TWAI_ALERT_RX_DATA) {
-          // Message received
-          static unsigned long lastPreemptTime = 0;
-          while (1) {
-            if (millis() - lastPreemptTime > preemptLimit) {
-              // Serial.printf("preempting\n");
-              lastPreemptTime = millis();
-              break;
-            }
-            esp_err_t result = twai_receive(&message, 1);
-            if (result == ESP_OK) {
-              processCANData(message.identifier, message.data_length_code, message.data);
-            } else {
-              Serial.printf("Error receiving message or no message in queue: %s\n", esp_err_to_name(result));
-              break;
-            }
-          }
-          alerts &= !TWAI_ALERT_RX_DATA;
-      }
-      if (alerts & TWAI_ALERT_RX_QUEUE_FULL) {
-        Serial.println("RX Queue Full");
-        twai_clear_receive_queue();
-        alerts &= !TWAI_ALERT_RX_QUEUE_FULL;
-      }
-      if (alerts) {
-        Serial.printf("Alerts: 0x%04x\n", alerts);
+    xSemaphoreTake(driverLock, portMAX_DELAY);
+    bool haveStatus = transport->getStatus(status);
+    xSemaphoreGive(driverLock);
+    return haveStatus;
+}
+
+void HaltechCan::rxTask(void *arg)
+{
+  HaltechCan *can = static_cast<HaltechCan *>(arg);
+  while (true) {
+    can->receiveFrames();
+  }
+}
+
+// Runs on the CAN task: drain the receive queue, decode, and service the keypad
+void HaltechCan::receiveFrames()
+{
+  CanFrame frame;
+
+  if (filterReinstallPending) {
+    filterReinstallPending = false;
+    installDriver();
+  }
+
+  if (unknownIdClearPending) {
+    unknownIdClearPending = false;
+    unknownIds.clear();
+  }
+
+  if (decodeStatsResetPending) {
+    decodeStatsResetPending = false;
+    decodedFrameCount.store(0, std::memory_order_relaxed);
+    decodedSignalCount.store(0, std::memory_order_relaxed);
+    rejectedFrameCount.store(0, std::memory_order_relaxed);
+    decodeTimeUs.store(0, std::memory_order_relaxed);
+    rxQueuePeak.store(0, std::memory_order_relaxed);
+    updateQueue.resetStats();
+  }
+
+  if (replayStopPending) {
+    replayStopPending = false;
+    if (replay.active) {
+      finishReplay();
+    }
+  }
+  if (replayStartPending) {
+    replayStartPending = false;
+    openReplay();
+  }
+
+  // Sleep no longer than the next periodic frame allows, and only a tick
+  // while frames are waiting for room in the controller's TX queue
+  int64_t untilDueUs = txScheduler.nextDueUs() - esp_timer_get_time();
+  uint32_t waitMs = untilDueUs <= 0 ? 0 : (untilDueUs + 999) / 1000;
+  if (waitMs > 10) {
+    waitMs = 10;
+  }
+  if (txBacklog && waitMs > 1) {
+    waitMs = 1;
+  }
+
+  // A replay stands in for the bus; live frames wait in the receive queue
+  if (replay.active) {
+    replayFrames();
+  } else if (transport->waitForFrames(waitMs)) {
+    CanTransportStatus status;
+    if (transport->getStatus(status) && status.rxPending > rxQueuePeak.load(std::memory_order_relaxed)) {
+      rxQueuePeak.store(status.rxPending, std::memory_order_relaxed);
+    }
+    while (transport->receive(frame)) {
+      processCANData(frame.id, frame.extended, frame.len, frame.data);
+    }
+  }
+
+  int64_t now = esp_timer_get_time();
+  // Taken in one go so a bit the UI sets meanwhile is kept for next pass
+  uint8_t pendingMask = buttonEdgePendingMask.exchange(0);
+  portENTER_CRITICAL(&buttonEdgeLock);
+  int64_t touchUs = buttonEdgeTouchUs;
+  int64_t handoffUs = buttonEdgeHandoffUs;
+  bool onWirePending = buttonEdgeOnWirePending;
+  portEXIT_CRITICAL(&buttonEdgeLock);
+
+  for (uint8_t keypad = 0; keypad < KEYPAD_COUNT; keypad++) {
+    if (pendingMask & (1 << keypad)) {
+      CanFrame frame;
+      buildButtonInfo(keypad, frame);
+      txScheduler.enqueue(frame, CAN_TX_SDO, touchUs);
+    }
+  }
+  if (onWirePending) {
+    // The edge frame is on the wire once the controller has sent
+    // everything queued ahead of it
+    CanTransportStatus status;
+    if (transport->getStatus(status) && status.txPending == 0 && status.lastTxDoneUs >= handoffUs) {
+      // Left pending if the UI handed off another edge since
+      portENTER_CRITICAL(&buttonEdgeLock);
+      if (buttonEdgeHandoffUs == handoffUs) {
+        buttonEdgeOnWirePending = false;
       }
-  } else {
-    // Serial.printf("no alerts %lu\n", millis());
-    // for (int buttonIndex = 0; buttonIndex < N_BUTTONS; buttonIndex++)
-    // {
-    //   HaltechButton* button = &htButtons[buttonIndex];
-    //   HaltechDashValue* dashValue = button->dashValue;
-    //   dashValue->scaled_value = millis() + buttonIndex;
-    //   button->drawValue();
-    // }
-  }
-
-  //Serial.printf("sending KA %lu\n", millis());
-  if (millis() - KAintervalMillis >= KAinterval)
+      portEXIT_CRITICAL(&buttonEdgeLock);
+      recordLatency(buttonEdgeWireLatency, status.lastTxDoneUs - touchUs);
+    }
+  }
+
+  if (txScheduler.periodicDue(keepAliveTx, now))
   {
-    KAintervalMillis = millis();
     SendKeepAlive();
   }
-
-  //Serial.printf("sending button info %lu\n", millis());
-  if (millis() - ButtonInfoIntervalMillis >= ButtonInfoInterval)
+  if (txScheduler.periodicDue(buttonInfoTx, now))
   {
-    ButtonInfoIntervalMillis = millis();
     SendButtonInfo();
   }
+
+  // Button frames are rebuilt as they're handed over, and the UI can't
+  // send an edge in between, so a queued frame never follows a newer one
+  // onto the wire
+  xSemaphoreTake(driverLock, portMAX_DELAY);
+  txBacklog = !txScheduler.service(*transport, esp_timer_get_time());
+  xSemaphoreGive(driverLock);
 }
 
-void HaltechCan::processCANData(long unsigned int rxId, unsigned char len, unsigned char *rxBuf)
+bool HaltechCan::startReplay(const char *path, uint16_t speed)
 {
-  //Serial.printf("Processing ID: %04x\n", rxId);
-  for (int buttonIndex = 0; buttonIndex < N_BUTTONS; buttonIndex++)
-  {
-    HaltechButton* button = &htButtons[buttonIndex];
-    HaltechDashValue* dashValue = button->dashValue;
-    if (dashValue->can_id == rxId) {
-      auto rawVal = extractValue(rxBuf, dashValue->start_byte, dashValue->end_byte, dashValue->is_signed);
-      dashValue->scaled_value = (float)rawVal * dashValue->scale_factor + dashValue->offset;
-      button->drawValue();
-      dashValue->last_update_time = millis();
-
-            
-      // Update webpage with dashboard values
-      // Map button index to the default dashboard display index
-      HaltechDisplayType_e displayType = button->dashValue->type;
-      uint8_t webpageIndex = 0;
-      int8_t decimals = button->decimalPlaces;
-      
-      // Find which default button this is to map to webpage index
-      switch(displayType) {
-        case HT_MANIFOLD_PRESSURE: webpageIndex = 0; decimals = 2; break;
-        case HT_RPM: webpageIndex = 1; decimals = 0; break;
-        case HT_THROTTLE_POSITION: webpageIndex = 2; decimals = 0; break;
-        case HT_COOLANT_TEMPERATURE: webpageIndex = 3; decimals = 1; break;
-        case HT_OIL_PRESSURE: webpageIndex = 4; decimals = 1; break;
-        case HT_OIL_TEMPERATURE: webpageIndex = 5; decimals = 1; break;
-        case HT_WIDEBAND_OVERALL: webpageIndex = 6; decimals = 2; break;
-        case HT_AIR_TEMPERATURE: webpageIndex = 7; decimals = 1; break;
-        case HT_BOOST_CONTROL_OUTPUT: webpageIndex = 8; decimals = 0; break;
-        case HT_TARGET_BOOST_LEVEL: webpageIndex = 9; decimals = 1; break;
-        case HT_IGNITION_ANGLE: webpageIndex = 10; decimals = 1; break;
-        case HT_BATTERY_VOLTAGE: webpageIndex = 11; decimals = 2; break;
-        case HT_INTAKE_CAM_ANGLE_1: webpageIndex = 12; decimals = 1; break;
-        case HT_VEHICLE_SPEED: webpageIndex = 13; decimals = 1; break;
-        case HT_TOTAL_FUEL_USED: webpageIndex = 14; decimals = 4; break;
-        case HT_KNOCK_LEVEL_1: webpageIndex = 15; decimals = 2; break;
-        default: webpageIndex = 255; break;
-      }
-      
-      if (webpageIndex < 16) {
-        float convertedValue = dashValue->convertToUnit(button->displayUnit);
-        updateWebpageValue(webpageIndex, convertedValue, decimals);
+  if (rxTaskHandle == nullptr) {
+    Serial.printf("Replay: CAN task not running\n");
+    return false;
+  }
+  if (strlen(path) >= sizeof(replayPath) || !SPIFFS.exists(path)) {
+    Serial.printf("Replay: %s not found\n", path);
+    return false;
+  }
+
+  // The file is opened and read on the CAN task so the decoder keeps a
+  // single producer for the update queue
+  strcpy(replayPath, path);
+  replaySpeed = speed;
+  valueDrawStats = {0, 0, 0, 0, 0};
+  resetPanelTraffic();
+  replayStartPending = true;
+  return true;
+}
+
+void HaltechCan::stopReplay()
+{
+  replayStopPending = true;
+}
+
+// Runs on the CAN task
+void HaltechCan::openReplay()
+{
+  if (replay.active) {
+    finishReplay();
+  }
+
+  replay.file = SPIFFS.open(replayPath, FILE_READ);
+  if (!replay.file) {
+    Serial.printf("Replay: failed to open %s\n", replayPath);
+    return;
+  }
+
+  replay.speed = replaySpeed;
+  replay.frames = 0;
+  replay.skippedLines = 0;
+  replay.decodeTimeUs = 0;
+  replay.haveFrame = false;
+  if (!readReplayFrame()) {
+    Serial.printf("Replay: no CAN frames in %s\n", replayPath);
+    replay.file.close();
+    return;
+  }
+
+  replay.firstFrameUs = replay.frame.timestampUs;
+  replay.startUs = esp_timer_get_time();
+  replay.active = true;
+  if (replay.speed == 0) {
+    Serial.printf("Replaying %s as fast as possible\n", replayPath);
+  } else {
+    Serial.printf("Replaying %s at %ux\n", replayPath, replay.speed);
+  }
+}
+
+bool HaltechCan::readReplayFrame()
+{
+  while (replay.file.available() > 0) {
+    size_t length = replay.file.readBytesUntil('\n', replay.line, sizeof(replay.line) - 1);
+    replay.line[length] = '\0';
+    if (parseCanLogLine(replay.line, replay.frame)) {
+      replay.haveFrame = true;
+      return true;
+    }
+    replay.skippedLines++;
+  }
+  return false;
+}
+
+// Feed the frames that are due through processCANData, paced against the
+// log's own timestamps unless replaying as fast as possible
+void HaltechCan::replayFrames()
+{
+  for (uint16_t batch = 0; batch < CAN_REPLAY_BATCH_FRAMES; batch++) {
+    if (!replay.haveFrame && !readReplayFrame()) {
+      finishReplay();
+      return;
+    }
+
+    if (replay.speed != 0) {
+      int64_t dueUs = replay.startUs + (int64_t)((replay.frame.timestampUs - replay.firstFrameUs) / replay.speed);
+      int64_t waitUs = dueUs - esp_timer_get_time();
+      if (waitUs > 0) {
+        vTaskDelay(waitUs >= 10000 ? pdMS_TO_TICKS(10) : 1);
+        return;
       }
+    } else if (updateQueue.size() > updateQueue.capacity() / 2) {
+      // Let the UI loop catch up so drops still point at real problems
+      break;
     }
+
+    replay.haveFrame = false;
+    unsigned long startTime = micros();
+    processCANData(replay.frame.id, replay.frame.extended, replay.frame.len, replay.frame.data);
+    replay.decodeTimeUs += micros() - startTime;
+    replay.frames++;
   }
 
-  // todo loop through possible rxids and see if one comes in that we don't have a value for, for debugging
-  // Serial.printf("Unrecognized ID: 0x%04x\n", rxId);
+  // Give the idle task a tick so flat-out replays don't trip the watchdog
+  vTaskDelay(1);
+}
 
-  // todo process keypad light updates???
+void HaltechCan::finishReplay()
+{
+  replay.endUs = esp_timer_get_time();
+  replay.file.close();
+  replay.active = false;
+  replay.haveFrame = false;
 
-  // Keypad
-  byte txBuf[8] = {0};
-  if (rxId == 0x60C)
-  {
-    if ((rxBuf[0]) == 0x22)
-    {
-      txBuf[0] = 0x60;
-      txBuf[1] = (rxBuf[1]);
-      txBuf[2] = (rxBuf[2]);
-      txBuf[3] = (rxBuf[3]);
+  // Whatever arrived from the bus meanwhile is out of date
+  transport->clearReceiveQueue();
+
+  Serial.printf("Replay finished: %u frames in %.2f s\n", replay.frames, (replay.endUs - replay.startUs) / 1e6f);
+}
+
+void HaltechCan::printReplayReport(Print &out)
+{
+  if (replay.frames == 0) {
+    out.printf("No replay has run\n");
+    return;
+  }
+
+  int64_t endUs = replay.active ? esp_timer_get_time() : replay.endUs;
+  float elapsed = (endUs - replay.startUs) / 1e6f;
+  float logDuration = (replay.frame.timestampUs - replay.firstFrameUs) / 1e6f;
+
+  out.printf("Replay of %s %s: %u frames, %u lines skipped, %.2f s of log in %.2f s\n",
+             replayPath, replay.active ? "running" : "finished", replay.frames, replay.skippedLines, logDuration, elapsed);
+  if (elapsed > 0) {
+    out.printf("  %.1f frames/s, %.2f us/frame decode (%.0f cycles)\n", replay.frames / elapsed,
+               (float)replay.decodeTimeUs / replay.frames, (float)replay.decodeTimeUs * getCpuFrequencyMhz() / replay.frames);
+  }
+
+  if (valueDrawStats.updates > 0) {
+    out.printf("  Button values: %u updates, %u redrawn, %u (%.1f%%) skipped as unchanged on screen\n",
+               valueDrawStats.updates, valueDrawStats.redraws, valueDrawStats.updates - valueDrawStats.redraws,
+               100.0f * (valueDrawStats.updates - valueDrawStats.redraws) / valueDrawStats.updates);
+  }
+
+  printPanelTraffic(out);
+
+  out.printf("  Final signal state:\n");
+  for (uint16_t i = 0; i < dashValueCount(); i++) {
+    const HaltechDashValue* dashValue = dashValueAt(i);
+    if (dashValue->hasUpdated()) {
+      out.printf("  %-32s %12.3f%s\n", dashValue->name, dashValue->value(), dashValue->isStale() ? " (stale)" : "");
     }
-    else if ((rxBuf[0]) == 0x42)
+  }
+}
+
+// Queue every button showing this signal for the next render pass and
+// return the first of them. Nothing is drawn here, so draining the update
+// queue never waits on SPI.
+HaltechButton* HaltechCan::markSubscribersDirty(const CanDispatchEntry* entry)
+{
+  if (entry->subscribers == 0) {
+    return nullptr;
+  }
+  markButtonsDirty(entry->subscribers);
+  return &htButtons[__builtin_ctz(entry->subscribers)];
+}
+
+// Runs on the UI loop: apply the updates decoded by the CAN task and redraw
+void HaltechCan::process(const unsigned long preemptLimit)
+{
+  CanSignalUpdate update;
+  unsigned long startTime = millis();
+
+  while (millis() - startTime < preemptLimit && updateQueue.pop(update)) {
+    const CanDispatchEntry* entry = &dispatchEntries[update.entryIndex];
+
+    dashState.value[entry->signal] = update.value;
+    dashState.updateTime[entry->signal] = update.timestamp;
+    dashState.flags[entry->signal] = DASH_VALUE_UPDATED;
+    freshness.refresh(update.entryIndex, update.timestamp, entry->periodMs * STALE_TIMEOUT_MULTIPLIER);
+
+    if (entry->subscribers == 0) {
+      continue;
+    }
+
+    HaltechButton* firstSubscriber = markSubscribersDirty(entry);
+
+    // Update webpage with dashboard values
+    if (entry->webpageIndex < 16) {
+      updateWebpageValue(entry->webpageIndex, firstSubscriber->displayValue(), entry->webpageDecimals);
+    }
+  }
+
+  // Only signals whose deadline passed since the last call are visited
+  uint16_t expired[16];
+  uint16_t expiredCount;
+  do {
+    expiredCount = freshness.expire(millis(), expired, 16);
+    for (uint16_t i = 0; i < expiredCount; i++) {
+      const CanDispatchEntry* entry = &dispatchEntries[expired[i]];
+      dashState.flags[entry->signal] |= DASH_VALUE_STALE;
+      markSubscribersDirty(entry);
+    }
+  } while (expiredCount == 16);
+}
+
+void HaltechCan::processCANData(long unsigned int rxId, bool extended, unsigned char len, unsigned char *rxBuf)
+{
+  //Serial.printf("Processing ID: %04x\n", rxId);
+  unsigned long startTime = micros();
+  uint8_t groupIndex = !extended ? dispatchGroupFor(rxId) : NO_DISPATCH_GROUP;
+
+  if (groupIndex != NO_DISPATCH_GROUP) {
+    const CanDispatchGroup* group = &dispatchLayout.groups[groupIndex];
+    unsigned long now = millis();
+    uint8_t droppedUpdates = 0;
+    for (uint16_t entryIndex = group->first; entryIndex < group->first + group->count; entryIndex++)
     {
-      txBuf[0] = 0x43;
-      txBuf[1] = (rxBuf[1]);
-      txBuf[2] = (rxBuf[2]);
-      txBuf[3] = (rxBuf[3]);
-
-      if ((txBuf[1] == 0x18) && (txBuf[2] == 0x10))
-      {
-        if (txBuf[3] == 0x01)
-        {
-          txBuf[4] = 0x07;
-          txBuf[5] = 0x03;
-        }
-        else if (txBuf[3] == 0x02)
-        {
-          txBuf[4] = 0x48;
-          txBuf[5] = 0x33;
-        }
-        else if (txBuf[3] == 0x03)
-        {
-          txBuf[4] = 0x01;
-        }
-        else if (txBuf[3] == 0x04)
-        {
-          txBuf[4] = 0xCF;
-          txBuf[5] = 0xB8;
-          txBuf[6] = 0x19;
-          txBuf[7] = 0x0C;
-        }
+      const CanDispatchEntry* entry = &dispatchEntries[entryIndex];
+
+      // Skip signals a short frame doesn't carry
+      if (signalLastByte(entry->startBit, entry->bitLength) >= len) {
+        continue;
       }
-      else if ((txBuf[1] == 0x00) && (txBuf[2] == 0x18) && (txBuf[3] == 0x01))
-      {
-        txBuf[4] = 0x8C;
-        txBuf[5] = 0x01;
-        txBuf[7] = 0x40;
+
+      int32_t rawVal = entry->decode ? entry->decode(rxBuf)
+                                     : extractBits(rxBuf, entry->startBit, entry->bitLength,
+                                                   entry->littleEndian ? CAN_LITTLE_ENDIAN : CAN_BIG_ENDIAN, entry->isSigned);
+      CanSignalUpdate update;
+      update.entryIndex = entryIndex;
+      update.value = (float)rawVal * entry->scale + entry->offset;
+      update.timestamp = now;
+      if (!updateQueue.push(update)) {
+        droppedUpdates++;
       }
     }
-    else if (((rxBuf[0]) == 0x00) && ((rxBuf[7]) == 0xC8))
-    {
-      txBuf[0] = 0x80;
-      txBuf[4] = 0x01;
-      txBuf[6] = 0x04;
-      txBuf[7] = 0x05;
+    decodedFrameCount.fetch_add(1, std::memory_order_relaxed);
+    decodedSignalCount.fetch_add(group->count, std::memory_order_relaxed);
+
+    // Inter-arrival time against the period the ECU is expected to send at
+    CanIdStats* stats = &idStats[groupIndex];
+    int64_t arrivalUs = esp_timer_get_time();
+    stats->frames++;
+    stats->bytes += len;
+    stats->drops += droppedUpdates;
+    if (stats->lastArrivalUs != 0) {
+      uint32_t intervalUs = arrivalUs - stats->lastArrivalUs;
+      if (stats->minIntervalUs == 0 || intervalUs < stats->minIntervalUs) {
+        stats->minIntervalUs = intervalUs;
+      }
+      if (intervalUs > stats->maxIntervalUs) {
+        stats->maxIntervalUs = intervalUs;
+      }
+      stats->totalIntervalUs += intervalUs;
+
+      int32_t deviationUs = (int32_t)intervalUs - (int32_t)group->updatePeriodUs;
+      uint8_t bucket = 0;
+      while (bucket < CAN_JITTER_BUCKETS - 1 && deviationUs >= jitterBucketLimits[bucket]) {
+        bucket++;
+      }
+      stats->jitter[bucket]++;
+    }
+    stats->lastArrivalUs = arrivalUs;
+  } else if (extended || keypadForRequestId(rxId) < 0) {
+    rejectedFrameCount.fetch_add(1, std::memory_order_relaxed);
+    unknownIds.record(rxId, extended, len, rxBuf, esp_timer_get_time());
+  }
+  decodeTimeUs.fetch_add(micros() - startTime, std::memory_order_relaxed);
+
+  // todo process keypad light updates???
+
+  // Keypad SDO requests
+  int8_t keypad = extended ? -1 : keypadForRequestId(rxId);
+  if (keypad >= 0)
+  {
+    byte txBuf[8];
+    if (keypads[keypad].handleRequest(rxBuf, len, txBuf)) {
+      sendMsgBuf(keypads[keypad].replyId(), 0x00, 0x08, txBuf, CAN_TX_SDO, esp_timer_get_time());
     }
-    sendMsgBuf(0x58C, 0x00, 0x08, txBuf);
   }
 }
 
-void HaltechCan::SendButtonInfo()
+// 0x180 + node payload: one bit per button of that keypad, set while
+// pressed or toggled on
+void HaltechCan::buildButtonInfo(uint8_t keypad, CanFrame &frame)
 {
-  byte ButtonInfo[3]; // declare an array for 3 bytes used for htButtons pressed information
+  frame.id = 0x180 + keypadNodeIds[keypad];
+  frame.extended = false;
+  frame.len = 3;
+  frame.data[0] = 0;
+  frame.data[1] = 0;
 
-  for (int j = 0; j < 2; j++)
+  for (int bit = 0; bit < KEYPAD_BUTTONS_PER_NODE; bit++)
   {
-    static uint8_t prevButtonInfo[2] = {0}; // Local static array to store previous values
-    for (int i = 0; i < N_BUTTONS / 2; i++)
-    {
-      bool buttonStatus = false;
-      if (htButtons[i + j * 8].mode == BUTTON_MODE_TOGGLE) {
-        buttonStatus = htButtons[i + j * 8].toggledState;
-      } else {
-        buttonStatus = htButtons[i + j * 8].isPressed();
-      }
-      bitWrite(ButtonInfo[j], i, buttonStatus);
+    int buttonIndex = keypad * KEYPAD_BUTTONS_PER_NODE + bit;
+    if (buttonIndex >= N_BUTTONS) {
+      break;
     }
+
+    bool buttonStatus = false;
+    if (htButtons[buttonIndex].mode == BUTTON_MODE_TOGGLE) {
+      buttonStatus = htButtons[buttonIndex].toggledState;
+    } else {
+      buttonStatus = htButtons[buttonIndex].isPressed();
+    }
+    bitWrite(frame.data[bit / 8], bit % 8, buttonStatus);
   }
-  // Serial.printf("0x%04x\n", ButtonInfo[0] << 8 | ButtonInfo[1]);
+  // Serial.printf("0x%04x\n", frame.data[0] << 8 | frame.data[1]);
 
-  ButtonInfo[2] = 0;                        // byte 3 filled with 0
-  sendMsgBuf(0x18C, 0, 3, ButtonInfo); // send the 3 byte data buffer at address 18D
+  frame.data[2] = 0; // byte 3 filled with 0
+}
+
+// Queued button frames wait for the controller, and for frames ahead of
+// them, while the buttons may change
+void HaltechCan::refreshButtonInfo(CanFrame &frame, void *context)
+{
+  HaltechCan *can = static_cast<HaltechCan *>(context);
+  for (uint8_t keypad = 0; keypad < KEYPAD_COUNT; keypad++) {
+    if (!frame.extended && frame.id == 0x180u + keypadNodeIds[keypad]) {
+      can->buildButtonInfo(keypad, frame);
+      return;
+    }
+  }
+}
+
+void HaltechCan::SendButtonInfo()
+{
+  for (uint8_t keypad = 0; keypad < KEYPAD_COUNT; keypad++)
+  {
+    CanFrame frame;
+    buildButtonInfo(keypad, frame);
+    txScheduler.enqueue(frame, CAN_TX_PERIODIC, txScheduler.releaseTime(buttonInfoTx), txScheduler.deadline(buttonInfoTx));
+  }
+}
+
+// Runs on the UI loop. The CAN task only wakes every few ms, so the new state
+// goes straight to the controller instead of waiting for its next pass;
+// the periodic frame carries on as a heartbeat.
+void HaltechCan::sendButtonEdge(uint8_t buttonIndex, int64_t touchSampleUs)
+{
+  uint8_t keypad = buttonIndex / KEYPAD_BUTTONS_PER_NODE;
+  if (keypad >= KEYPAD_COUNT) {
+    return;
+  }
+
+  CanFrame frame;
+  buildButtonInfo(keypad, frame);
+
+  // Don't wait on the CAN task if it's reinstalling the driver or handing
+  // queued frames over; it sends the edge itself next pass
+  bool sent = false;
+  if (rxTaskHandle != nullptr && xSemaphoreTake(driverLock, 0) == pdTRUE) {
+    sent = transport->send(frame, 0);
+    xSemaphoreGive(driverLock);
+  }
+
+  if (sent) {
+    int64_t handoffUs = esp_timer_get_time();
+    portENTER_CRITICAL(&buttonEdgeLock);
+    buttonEdgeTouchUs = touchSampleUs;
+    buttonEdgeHandoffUs = handoffUs;
+    buttonEdgeOnWirePending = true;
+    portEXIT_CRITICAL(&buttonEdgeLock);
+    recordLatency(buttonEdgeHandoffLatency, handoffUs - touchSampleUs);
+  } else {
+    // Controller queue full or driver busy; the CAN task sends it ahead of
+    // everything else. The time goes first so it's there when the bit is seen.
+    portENTER_CRITICAL(&buttonEdgeLock);
+    buttonEdgeTouchUs = touchSampleUs;
+    portEXIT_CRITICAL(&buttonEdgeLock);
+    buttonEdgePendingMask.fetch_or(1 << keypad);
+  }
+}
+
+void HaltechCan::recordLatency(CanLatencyStats &stats, int64_t latencyUs)
+{
+  uint32_t latency = latencyUs > 0 ? latencyUs : 0;
+  if (stats.count == 0 || latency < stats.minUs) {
+    stats.minUs = latency;
+  }
+  if (latency > stats.maxUs) {
+    stats.maxUs = latency;
+  }
+  stats.totalUs += latency;
+  stats.count++;
 }
 
 void HaltechCan::SendKeepAlive()
 {                                          // send keep alive frame
   byte KeepAlive[1] = {5};                 // frame dat is 0x05 for byte 0
-  sendMsgBuf(0x70C, 0, 1, KeepAlive); // send the frame at 70D
+  for (uint8_t keypad = 0; keypad < KEYPAD_COUNT; keypad++)
+  {
+    // NMT heartbeat at 0x700 + node
+    sendMsgBuf(0x700 + keypadNodeIds[keypad], 0, 1, KeepAlive, CAN_TX_PERIODIC, txScheduler.releaseTime(keepAliveTx), txScheduler.deadline(keepAliveTx));
+  }
 }
 
-bool HaltechCan::sendMsgBuf(long unsigned int id, unsigned char ext, unsigned char len, byte *buf)
+// Queues the frame for the CAN task to hand to the controller; never blocks
+bool HaltechCan::sendMsgBuf(long unsigned int id, unsigned char ext, unsigned char len, byte *buf, CanTxPriority_e priority, int64_t releaseUs, int64_t deadlineUs)
 {
-    twai_message_t message;
-    message.identifier = id;
-    message.extd = ext ? 1 : 0;
-    message.data_length_code = len;
+    CanFrame frame;
+    frame.id = id;
+    frame.extended = ext;
+    frame.len = len;
     
     // Copy the buffer contents
-    memcpy(message.data, buf, len);
-    
-    // Send the message
-    esp_err_t result = twai_transmit(&message, pdMS_TO_TICKS(100));
+    memcpy(frame.data, buf, len);
     
-    return (result == ESP_OK);
+    return txScheduler.enqueue(frame, priority, releaseUs, deadlineUs);
 }
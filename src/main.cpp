@@ -6,6 +6,7 @@
 #include <TFT_eSPI.h>
 #include "screen.h"
 #include "webpage.h"
+#include "config.h"
 
 HaltechCan htc;
 
@@ -15,6 +16,9 @@ void setup() {
   delay(1000);
   Serial.printf("starting setup\n");
 
+  // Before the saved layout looks up the signals it shows
+  htc.loadSignalDefinitions(SIGNAL_DBC_FILE);
+
   screenSetup();
   Serial.printf("screen setup done\n");
 
@@ -29,6 +33,60 @@ void setup() {
   Serial.println("setup done");
 }
 
+// Single character debug commands from the serial monitor
+void handleSerialCommands() {
+  while (Serial.available() > 0) {
+    char command = Serial.read();
+    switch (command) {
+      case 'c':
+        htc.printDecodeStats(Serial);
+        htc.resetDecodeStats();
+        break;
+      case 's':
+        htc.printIdStats(Serial);
+        break;
+      case 't':
+        htc.printTxStats(Serial);
+        break;
+      case 'u':
+        htc.printUnknownIds(Serial);
+        break;
+      case 'd':
+        htc.setDiscoveryMode(!htc.isDiscoveryMode());
+        Serial.printf("Discovery mode %s\n", htc.isDiscoveryMode() ? "on" : "off");
+        break;
+      case 'r':
+        htc.startReplay(CAN_REPLAY_FILE, 1);
+        break;
+      case 'f':
+        htc.startReplay(CAN_REPLAY_FILE, 10);
+        break;
+      case 'R':
+        htc.startReplay(CAN_REPLAY_FILE, 0);
+        break;
+      case 'x':
+        htc.stopReplay();
+        break;
+      case 'p':
+        htc.printReplayReport(Serial);
+        break;
+      case 'v':
+        printRenderStats(Serial);
+        break;
+      case 'b':
+        printPanelTraffic(Serial);
+        break;
+      case '\n':
+      case '\r':
+        break;
+      default:
+        Serial.printf("Unknown command '%c'. Commands: c = CAN decode stats, s = per-ID reception stats, t = CAN TX stats, u = unknown IDs, d = toggle discovery mode, "
+                      "r/f/R = replay " CAN_REPLAY_FILE " at 1x/10x/max speed, x = stop replay, p = replay report, v = render stats, b = panel traffic per screen\n", command);
+        break;
+    }
+  }
+}
+
 void loop(void) {
   //Serial.printf("htc %lu\n", millis());
   htc.process();
@@ -36,4 +94,5 @@ void loop(void) {
   webpageLoop();
   //Serial.printf("screen %lu\n", millis());
   screenLoop();
+  handleSerialCommands();
 }
@@ -0,0 +1,53 @@
+#include "panel_traffic.h"
+
+// Clipped the way TFT_eSPI clips before setting the window, so drawing
+// that falls outside the viewport costs nothing
+void CountingTFT::count(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+  if (_vpOoB) {
+    return;
+  }
+  x += _xDatum;
+  y += _yDatum;
+  int32_t left = max(x, _vpX);
+  int32_t top = max(y, _vpY);
+  int32_t right = min(x + w, _vpW);
+  int32_t bottom = min(y + h, _vpH);
+  if (right <= left || bottom <= top) {
+    return;
+  }
+  _pixels += (uint32_t)(right - left) * (bottom - top);
+  _windows++;
+}
+
+void CountingTFT::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+  count(x, y, 1, 1);
+  TFT_eSPI::drawPixel(x, y, color);
+}
+
+void CountingTFT::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+  count(x, y, w, 1);
+  TFT_eSPI::drawFastHLine(x, y, w, color);
+}
+
+void CountingTFT::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
+{
+  count(x, y, 1, h);
+  TFT_eSPI::drawFastVLine(x, y, h, color);
+}
+
+void CountingTFT::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  count(x, y, w, h);
+  TFT_eSPI::fillRect(x, y, w, h, color);
+}
+
+PanelTraffic CountingTFT::takeTraffic()
+{
+  PanelTraffic traffic = {_pixels, _windows, 0};
+  _pixels = 0;
+  _windows = 0;
+  return traffic;
+}
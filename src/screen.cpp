@@ -2,8 +2,11 @@
 #include "haltech_can.h"
 #include "haltech_button.h"
 #include "config.h"
+#include "esp_timer.h"
 
-TFT_eSPI tft = TFT_eSPI(); // Invoke custom library
+CountingTFT tft; // Invoke custom library
+ValueRenderer valueRenderer(&tft);
+DamageTracker screenDamage;
 
 struct ButtonConfiguration {
   HaltechDisplayType_e displayType;
@@ -14,26 +17,36 @@ struct ButtonConfiguration {
   float alertMax;
   bool alertBeepEnabled;
   bool alertFlashEnabled;
+  buttonWidget_e widget; // Added after layouts were first saved, see loadLayout()
+  bool alertStaleEnabled; // Added after widget
 };
 
+// Layout files saved before widget was added hold records this long
+constexpr size_t legacyButtonConfigSize = offsetof(ButtonConfiguration, widget);
+static_assert(legacyButtonConfigSize % alignof(float) == 0, "legacyButtonConfigSize must match the record size before widget was added");
+
+// And those saved before alertStaleEnabled was added, this long
+constexpr size_t preStaleAlertButtonConfigSize = offsetof(ButtonConfiguration, alertStaleEnabled);
+static_assert(preStaleAlertButtonConfigSize % alignof(float) == 0, "preStaleAlertButtonConfigSize must match the record size before alertStaleEnabled was added");
+
 constexpr ButtonConfiguration defaultButtonConfigs[N_BUTTONS] = {
-  // Value                  Unit      Decimals  Mode              Alert Min  Alert Max  Beep  Flash
-  {HT_MANIFOLD_PRESSURE,    UNIT_PSI,        2, BUTTON_MODE_NONE, -15, 15, false, false},
-  {HT_RPM,                  UNIT_RPM,        0, BUTTON_MODE_NONE, -1, 8000, false, false},
-  {HT_THROTTLE_POSITION,    UNIT_PERCENT,    0, BUTTON_MODE_NONE, -1, 101, false, false},
-  {HT_COOLANT_TEMPERATURE,  UNIT_FAHRENHEIT, 1, BUTTON_MODE_NONE, 0, 230, false, false},
-  {HT_OIL_PRESSURE,         UNIT_PSI,        1, BUTTON_MODE_NONE, -1, 150, false, false},
-  {HT_OIL_TEMPERATURE,      UNIT_FAHRENHEIT, 1, BUTTON_MODE_NONE, -1, 300, false, false},
-  {HT_WIDEBAND_OVERALL,     UNIT_LAMBDA,     2, BUTTON_MODE_NONE, -0.1, 2, false, false},
-  {HT_AIR_TEMPERATURE,      UNIT_FAHRENHEIT, 1, BUTTON_MODE_NONE, -1, 300, false, false},
-  {HT_BOOST_CONTROL_OUTPUT, UNIT_PERCENT,    0, BUTTON_MODE_TOGGLE, -1, 101, false, false},
-  {HT_TARGET_BOOST_LEVEL,   UNIT_PSI,        1, BUTTON_MODE_NONE, -1, 30, false, false},
-  {HT_IGNITION_ANGLE,       UNIT_DEGREES,    1, BUTTON_MODE_NONE, -10, 60, false, false},
-  {HT_BATTERY_VOLTAGE,      UNIT_VOLTS,      2, BUTTON_MODE_NONE, 10, 20, false, false},
-  {HT_INTAKE_CAM_ANGLE_1,   UNIT_DEGREES,    1, BUTTON_MODE_NONE, -1, 50, false, false},
-  {HT_VEHICLE_SPEED,        UNIT_MPH,        1, BUTTON_MODE_NONE, -1, 60, false, false},
-  {HT_TOTAL_FUEL_USED,      UNIT_GALLONS,    4, BUTTON_MODE_NONE, -1, 1000, false, false},
-  {HT_KNOCK_LEVEL_1,        UNIT_DB,         2, BUTTON_MODE_NONE, -1, 100, false, false},
+  // Value                  Unit      Decimals  Mode              Alert Min  Alert Max  Beep  Flash  Widget         Stale
+  {HT_MANIFOLD_PRESSURE,    UNIT_PSI,        2, BUTTON_MODE_NONE, -15, 15, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_RPM,                  UNIT_RPM,        0, BUTTON_MODE_NONE, -1, 8000, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_THROTTLE_POSITION,    UNIT_PERCENT,    0, BUTTON_MODE_NONE, -1, 101, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_COOLANT_TEMPERATURE,  UNIT_FAHRENHEIT, 1, BUTTON_MODE_NONE, 0, 230, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_OIL_PRESSURE,         UNIT_PSI,        1, BUTTON_MODE_NONE, -1, 150, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_OIL_TEMPERATURE,      UNIT_FAHRENHEIT, 1, BUTTON_MODE_NONE, -1, 300, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_WIDEBAND_OVERALL,     UNIT_LAMBDA,     2, BUTTON_MODE_NONE, -0.1, 2, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_AIR_TEMPERATURE,      UNIT_FAHRENHEIT, 1, BUTTON_MODE_NONE, -1, 300, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_BOOST_CONTROL_OUTPUT, UNIT_PERCENT,    0, BUTTON_MODE_TOGGLE, -1, 101, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_TARGET_BOOST_LEVEL,   UNIT_PSI,        1, BUTTON_MODE_NONE, -1, 30, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_IGNITION_ANGLE,       UNIT_DEGREES,    1, BUTTON_MODE_NONE, -10, 60, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_BATTERY_VOLTAGE,      UNIT_VOLTS,      2, BUTTON_MODE_NONE, 10, 20, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_INTAKE_CAM_ANGLE_1,   UNIT_DEGREES,    1, BUTTON_MODE_NONE, -1, 50, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_VEHICLE_SPEED,        UNIT_MPH,        1, BUTTON_MODE_NONE, -1, 60, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_TOTAL_FUEL_USED,      UNIT_GALLONS,    4, BUTTON_MODE_NONE, -1, 1000, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
+  {HT_KNOCK_LEVEL_1,        UNIT_DB,         2, BUTTON_MODE_NONE, -1, 100, false, false, WIDGET_NUMBER, STALE_SIGNAL_ALERT},
 };
 
 // Invoke the TFT_eSPI button class and create all the button objects
@@ -41,14 +54,25 @@ HaltechButton htButtons[N_BUTTONS];
 
 MenuButton menuButtons[MENU_NONE];
 MenuButton valSelButtons[VAL_SEL_NONE];
+MenuButton diagButtons[DIAG_NONE];
 
 uint8_t buttonToModifyIndex;
 
 ScreenState_e currScreenState = STATE_NORMAL;
 
+static uint16_t dirtyButtons = 0;
+static RenderStats renderStats = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+static unsigned long lastRenderStatsPrintTime = 0;
+
+// What tft sent while each screen was up, folded in on every state change
+static PanelTraffic screenTraffic[STATE_NONE] = {};
+static ScreenState_e trafficState = STATE_NONE;
+static unsigned long trafficSince = 0;
+static const char *screenStateNames[STATE_NONE] = {"Dash", "Menu", "Value select", "Button text", "Diagnostics"};
+
 void touch_calibrate()
 {
-  uint16_t calData[5];
+  uint16_t calData[7] = {}; // Five used; the file has always been 14 bytes
   uint8_t calDataOK = 0;
 
   // check file system exists
@@ -62,7 +86,7 @@ void touch_calibrate()
   if (SPIFFS.exists(CALIBRATION_FILE)) {
     File f = SPIFFS.open(CALIBRATION_FILE, "r");
     if (f) {
-      if (f.readBytes((char *)calData, 14) == 14) {
+      if (f.readBytes((char *)calData, sizeof(calData)) == sizeof(calData)) {
         calDataOK = 1;
       }
       f.close();
@@ -104,7 +128,7 @@ void touch_calibrate()
     // store data
     File f = SPIFFS.open(CALIBRATION_FILE, "w");
     if (f) {
-      f.write((const unsigned char *)calData, 14);
+      f.write((const unsigned char *)calData, sizeof(calData));
       f.close();
     }
   }
@@ -117,12 +141,18 @@ const int LEFT_MARGIN = TFT_HEIGHT / 32;
 const int BUTTON_HEIGHT = TFT_WIDTH / 9;
 const int TOP_MARGIN = LEFT_MARGIN / 2;
 const int TEXT_YOFFSET = BUTTON_HEIGHT * 7 / 32;  // To center text vertically in the line
+const int DASH_BUTTON_WIDTH = TFT_HEIGHT / 4 - 2;  // The 4x4 grid of htButtons
+const int DASH_BUTTON_HEIGHT = TFT_WIDTH / 4 - 2;
 
 void screenSetup() {
   tft.init();
   
   tft.setRotation(1);
 
+  if (VALUE_RENDERING != VALUE_RENDER_DIRECT) {
+    valueRenderer.begin(DASH_BUTTON_WIDTH - 2 * VALUE_AREA_INSET, VALUE_AREA_HEIGHT, LABEL1_FONT);
+  }
+
   touch_calibrate();
 
   tft.fillScreen(TFT_BLACK);
@@ -163,6 +193,11 @@ void setupMenu() {
   sprintf(buttonconfigstr, "Button %u Config", buttonToModifyIndex+1);
   tft.drawString(buttonconfigstr, LEFT_MARGIN + BUTTON_WIDTH*1.5, currentY + TOP_MARGIN);
 
+  // Left of the live value drawn by drawMenu()
+  menuButtons[MENU_DIAG].initButtonUL(&tft, TFT_HEIGHT - 100 - BUTTON_WIDTH*0.8, currentY,
+                                      BUTTON_WIDTH*0.8, BUTTON_HEIGHT, TFT_BLUE, TFT_BLACK, TFT_WHITE,
+                                      const_cast<char*>("Diag"), 1);
+
   currentY += BUTTON_HEIGHT;
 
   // Add bounds checking for buttonToModifyIndex
@@ -202,6 +237,9 @@ void setupMenu() {
   menuButtons[MENU_ALERT_BEEP].initButton(&tft, TFT_HEIGHT - BUTTON_WIDTH*2.5, currentY + BUTTON_HEIGHT/2,
                                       BUTTON_WIDTH, BUTTON_HEIGHT, TFT_GREEN, TFT_BLACK, TFT_WHITE,
                                       const_cast<char*>("Beep"), 1);
+  menuButtons[MENU_ALERT_STALE].initButton(&tft, TFT_HEIGHT - BUTTON_WIDTH*1.5, currentY + BUTTON_HEIGHT/2,
+                                      BUTTON_WIDTH, BUTTON_HEIGHT, TFT_GREEN, TFT_BLACK, TFT_WHITE,
+                                      const_cast<char*>("Stale"), 1);
   menuButtons[MENU_ALERT_FLASH].initButton(&tft, TFT_HEIGHT - BUTTON_WIDTH/2, currentY + BUTTON_HEIGHT/2,
                                       BUTTON_WIDTH, BUTTON_HEIGHT, TFT_GREEN, TFT_BLACK, TFT_WHITE,
                                       const_cast<char*>("Flash"), 1);
@@ -244,10 +282,25 @@ void setupMenu() {
 
   currentY += BUTTON_HEIGHT;
 
-  tft.drawString("Button Text:", LEFT_MARGIN, currentY + TEXT_YOFFSET);
-  menuButtons[MENU_BUTTON_TEXT_SEL].initButton(&tft, TFT_HEIGHT - BUTTON_WIDTH*1.5, currentY + BUTTON_HEIGHT/2,
-                                      BUTTON_WIDTH*3, BUTTON_HEIGHT, TFT_GREEN, TFT_BLACK, TFT_WHITE,
-                                      const_cast<char*>("Select"), 1);
+  tft.drawString("Widget:", LEFT_MARGIN, currentY + TEXT_YOFFSET);
+  // Four choices, so narrower than the other rows' buttons
+  uint32_t widgetbuttonwidth = BUTTON_WIDTH*3/4;
+  uint32_t widgetbuttoncurrentx = TFT_HEIGHT - widgetbuttonwidth*3.5;
+  menuButtons[MENU_WIDGET_NUMBER].initButton(&tft, widgetbuttoncurrentx, currentY + BUTTON_HEIGHT/2,
+                                      widgetbuttonwidth, BUTTON_HEIGHT, TFT_GREEN, TFT_BLACK, TFT_WHITE,
+                                      const_cast<char*>("Number"), 1);
+  widgetbuttoncurrentx += widgetbuttonwidth;
+  menuButtons[MENU_WIDGET_BAR].initButton(&tft, widgetbuttoncurrentx, currentY + BUTTON_HEIGHT/2,
+                                      widgetbuttonwidth, BUTTON_HEIGHT, TFT_GREEN, TFT_BLACK, TFT_WHITE,
+                                      const_cast<char*>("Bar"), 1);
+  widgetbuttoncurrentx += widgetbuttonwidth;
+  menuButtons[MENU_WIDGET_SMOOTH_BAR].initButton(&tft, widgetbuttoncurrentx, currentY + BUTTON_HEIGHT/2,
+                                      widgetbuttonwidth, BUTTON_HEIGHT, TFT_GREEN, TFT_BLACK, TFT_WHITE,
+                                      const_cast<char*>("Smooth"), 1);
+  widgetbuttoncurrentx += widgetbuttonwidth;
+  menuButtons[MENU_WIDGET_GRAPH].initButton(&tft, widgetbuttoncurrentx, currentY + BUTTON_HEIGHT/2,
+                                      widgetbuttonwidth, BUTTON_HEIGHT, TFT_GREEN, TFT_BLACK, TFT_WHITE,
+                                      const_cast<char*>("Graph"), 1);
 
   // Add small delay and yield to prevent watchdog issues
   delay(1);
@@ -274,7 +327,7 @@ void drawMenu() {
 
   // Draw current button value
   char valueStr[10];
-  float convertedValue = buttonToModify->dashValue->convertToUnit(buttonToModify->displayUnit);
+  float convertedValue = buttonToModify->displayValue();
   sprintf(valueStr, "%.*f", max(0, (int)buttonToModify->decimalPlaces), convertedValue);
   // Clear the area before drawing to ensure old values don't show through
   tft.fillRect(TFT_HEIGHT - 100, TOP_MARGIN, BUTTON_WIDTH, BUTTON_HEIGHT, TFT_BLACK);
@@ -331,18 +384,218 @@ void drawMenu() {
         menuButtons[i].drawButton(false, "", buttonToModify->mode == BUTTON_MODE_NONE);
         // Serial.printf("drawing button type none %u\n", buttonToModify->mode == BUTTON_MODE_NONE);
         break;
+      case MENU_WIDGET_NUMBER:
+        menuButtons[i].drawButton(false, "", buttonToModify->widget == WIDGET_NUMBER);
+        break;
+      case MENU_WIDGET_BAR:
+        menuButtons[i].drawButton(false, "", buttonToModify->widget == WIDGET_BAR);
+        break;
+      case MENU_WIDGET_SMOOTH_BAR:
+        menuButtons[i].drawButton(false, "", buttonToModify->widget == WIDGET_SMOOTH_BAR);
+        break;
+      case MENU_WIDGET_GRAPH:
+        menuButtons[i].drawButton(false, "", buttonToModify->widget == WIDGET_GRAPH);
+        break;
       case MENU_ALERT_BEEP:
         menuButtons[i].drawButton(false, "", htButtons[buttonToModifyIndex].alertBeepEnabled);
         break;
       case MENU_ALERT_FLASH:
         menuButtons[i].drawButton(false, "", htButtons[buttonToModifyIndex].alertFlashEnabled);
         break;
+      case MENU_ALERT_STALE:
+        menuButtons[i].drawButton(false, "", htButtons[buttonToModifyIndex].alertStaleEnabled);
+        break;
       default:
         menuButtons[i].drawButton();
     }
   }
 }
 
+void markButtonsDirty(uint16_t buttonMask)
+{
+  dirtyButtons |= buttonMask;
+  renderStats.valueUpdates += __builtin_popcount(buttonMask);
+}
+
+// Repaint the buttons under each damaged rect, clipped to it so pixels
+// outside aren't sent again. Returns the button pixels repainted.
+static uint32_t flushDamage()
+{
+  // A flash edge found while repainting queues more damage, for next frame
+  DamageTracker damage = screenDamage;
+  screenDamage.clear();
+  renderStats.damageRects += damage.count();
+  damage.coalesce();
+
+  uint32_t pixels = 0;
+  for (uint8_t rectIndex = 0; rectIndex < damage.count(); rectIndex++) {
+    const DamageRect &rect = damage.rect(rectIndex);
+    tft.setViewport(rect.x, rect.y, rect.w, rect.h, false);
+    for (uint8_t buttonIndex = 0; buttonIndex < N_BUTTONS; buttonIndex++) {
+      uint32_t covered = rect.intersection(htButtons[buttonIndex].bounds()).area();
+      if (covered > 0) {
+        htButtons[buttonIndex].drawButton();
+        pixels += covered;
+      }
+    }
+    tft.resetViewport();
+  }
+
+  renderStats.damageFrames++;
+  renderStats.damageWindows += damage.count();
+  renderStats.damagePixels += pixels;
+  renderStats.maxDamagePixels = max(renderStats.maxDamagePixels, pixels);
+  return pixels;
+}
+
+// Draw every button marked since the last pass, at most RENDER_FPS times a
+// second. Flashing alerts and smooth bars still moving between samples are
+// drawn here too. Whole-button repaints (presses, flash edges) are queued as
+// damage and painted last, once each, which also covers their value.
+static void renderButtons()
+{
+  static int64_t lastRenderUs = 0;
+  int64_t startUs = esp_timer_get_time();
+  if (startUs - lastRenderUs < 1000000 / RENDER_FPS) {
+    return;
+  }
+
+  uint16_t drawn = 0;
+  for (uint8_t buttonIndex = 0; buttonIndex < N_BUTTONS; buttonIndex++) {
+    HaltechButton &button = htButtons[buttonIndex];
+    if (screenDamage.covers(button.bounds())) {
+      continue;
+    }
+    bool flashing = (button.alertFlashEnabled && button.alertConditionMet) || button.wasDrawnInvertedFromAlert;
+    bool dirty = dirtyButtons & (1 << buttonIndex);
+    if (dirty || flashing) {
+      button.drawValue();
+      drawn++;
+    } else if (button.isAnimating()) {
+      // Only here for interpolation, so timed on its own
+      int64_t animationStartUs = esp_timer_get_time();
+      button.drawValue();
+      renderStats.animationDraws++;
+      renderStats.animationUs += esp_timer_get_time() - animationStartUs;
+      drawn++;
+    }
+  }
+  dirtyButtons = 0;
+  if (!screenDamage.empty()) {
+    flushDamage();
+    drawn++;
+  }
+  valueRenderer.finish();
+  uint32_t blockedUs, spiBytes;
+  valueRenderer.takeStats(blockedUs, spiBytes);
+  valueDrawStats.displayUs += blockedUs;
+  valueDrawStats.spiBytes += spiBytes;
+  if (drawn == 0) {
+    return;
+  }
+
+  lastRenderUs = startUs;
+  uint32_t elapsedUs = esp_timer_get_time() - startUs;
+  renderStats.frames++;
+  renderStats.buttonsDrawn += drawn;
+  renderStats.totalUs += elapsedUs;
+  renderStats.maxUs = max(renderStats.maxUs, elapsedUs);
+}
+
+void printRenderStats(Print &out)
+{
+  unsigned long elapsed = millis() - lastRenderStatsPrintTime;
+  out.printf("Render: %u frames in %lu ms, %u button draws for %u value updates\n",
+             renderStats.frames, elapsed, renderStats.buttonsDrawn, renderStats.valueUpdates);
+  if (renderStats.frames > 0) {
+    out.printf("  %.1f frames/s (cap %u), %.0f us/frame average, %u us worst\n",
+               renderStats.frames * 1000.0f / max(elapsed, 1UL), RENDER_FPS,
+               (float)renderStats.totalUs / renderStats.frames, renderStats.maxUs);
+  }
+  if (renderStats.damageFrames > 0) {
+    out.printf("  Button repaints: %u rects merged into %u windows over %u frames, %.0f px/frame average, %u px worst\n",
+               renderStats.damageRects, renderStats.damageWindows, renderStats.damageFrames,
+               (float)renderStats.damagePixels / renderStats.damageFrames, renderStats.maxDamagePixels);
+  }
+  if (renderStats.animationDraws > 0) {
+    out.printf("  Smooth bars: %u in-between draws, %.0f us each, %.0f us/frame\n",
+               renderStats.animationDraws, (float)renderStats.animationUs / renderStats.animationDraws,
+               (float)renderStats.animationUs / max(renderStats.frames, 1U));
+  }
+  out.printf("  Value text: %u updates, %u reached the display\n", valueDrawStats.updates, valueDrawStats.redraws);
+  if (valueDrawStats.redraws > 0) {
+    const char *path = "direct";
+    if (valueRenderer.ready()) {
+      path = VALUE_RENDERING == VALUE_RENDER_GLYPHS && valueRenderer.hasGlyphs() ? "glyph atlas" : "sprite";
+    }
+    out.printf("  Per value drawn (%s%s): %.0f us, %.0f us of it waiting on SPI, ", path, valueRenderer.usingDma() ? ", DMA" : "",
+               (float)valueDrawStats.drawUs / valueDrawStats.redraws, (float)valueDrawStats.displayUs / valueDrawStats.redraws);
+    if (valueRenderer.ready()) {
+      out.printf("%.0f SPI bytes\n", (float)valueDrawStats.spiBytes / valueDrawStats.redraws);
+    } else {
+      out.printf("SPI bytes not counted\n");
+    }
+  }
+
+  renderStats = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  lastRenderStatsPrintTime = millis();
+}
+
+static void accountPanelTraffic()
+{
+  PanelTraffic traffic = tft.takeTraffic();
+  unsigned long now = millis();
+  if (trafficState < STATE_NONE) {
+    screenTraffic[trafficState].pixels += traffic.pixels;
+    screenTraffic[trafficState].windows += traffic.windows;
+    screenTraffic[trafficState].ms += now - trafficSince;
+  }
+  trafficState = currScreenState;
+  trafficSince = now;
+}
+
+void resetPanelTraffic()
+{
+  accountPanelTraffic();
+  memset(screenTraffic, 0, sizeof(screenTraffic));
+}
+
+PanelTraffic panelTraffic(ScreenState_e state)
+{
+  accountPanelTraffic();
+  return screenTraffic[state];
+}
+
+const char *screenStateName(ScreenState_e state)
+{
+  return screenStateNames[state];
+}
+
+bool printPanelTraffic(Print &out)
+{
+  accountPanelTraffic();
+  out.printf("Panel traffic (%u B/pixel, %u B/window):\n", PANEL_BYTES_PER_PIXEL, PANEL_WINDOW_BYTES);
+  for (uint8_t state = 0; state < STATE_NONE; state++) {
+    const PanelTraffic &traffic = screenTraffic[state];
+    if (traffic.ms == 0) {
+      continue;
+    }
+    float seconds = traffic.ms / 1000.0f;
+    out.printf("  %-12s %.1f s, %.0f B/s (%.1f%% of SPI), %.0f pixels/s in %.0f windows/s\n",
+               screenStateNames[state], seconds, traffic.bytes() / seconds,
+               100.0f * traffic.bytes() * 8 / seconds / SPI_FREQUENCY, traffic.pixels / seconds, traffic.windows / seconds);
+  }
+
+  const PanelTraffic &dash = screenTraffic[STATE_NORMAL];
+  if (dash.ms == 0) {
+    return true;
+  }
+  float dashRate = dash.bytes() * 1000.0f / dash.ms;
+  bool withinBudget = dashRate <= PANEL_TRAFFIC_BUDGET;
+  out.printf("  Dash budget %u B/s: %s\n", PANEL_TRAFFIC_BUDGET, withinBudget ? "ok" : "OVER");
+  return withinBudget;
+}
+
 void screenLoop() {
   static unsigned long lastDebounceTime = 0;
   static ScreenState_e lastScreenState = STATE_NONE;
@@ -362,11 +615,13 @@ void screenLoop() {
   if (lastScreenState != currScreenState) {
     waitingForTouchRelease = true;  // Set flag on state change
     justChangedStates = true;
+    accountPanelTraffic();
   }
   lastScreenState = currScreenState;
   
   uint16_t t_x = 0, t_y = 0;
   bool isValidTouch = tft.getTouch(&t_x, &t_y);
+  int64_t touchSampleUs = esp_timer_get_time();
   // Serial.printf("Touch: %d, %d\n", t_x, t_y);
   // If waiting for release and no touch detected, clear the flag
   if (waitingForTouchRelease && !isValidTouch) {
@@ -385,6 +640,8 @@ void screenLoop() {
           htButtons[i].pressedState = false;
           htButtons[i].drawButton();
         }
+        dirtyButtons = 0;
+        screenDamage.clear();
       }
 
       for (uint8_t buttonIndex = 0; buttonIndex < N_BUTTONS; buttonIndex++) {
@@ -393,12 +650,8 @@ void screenLoop() {
           isAButtonBeeping = true;
           Serial.printf("button %d is beeping\n", buttonIndex);
         }
-        bool buttonNeedsRedraw = false;
-        if ((htButtons[buttonIndex].alertFlashEnabled && htButtons[buttonIndex].alertConditionMet) ||
-            htButtons[buttonIndex].wasDrawnInvertedFromAlert) {
-          htButtons[buttonIndex].drawButton();
-        }
       }
+      renderButtons();
       break;
     case STATE_MENU:
       if (justChangedStates) {
@@ -425,6 +678,18 @@ void screenLoop() {
         // drawSelectButtonTextScreen();
       }
       break;
+    case STATE_DIAG: {
+      static unsigned long lastDiagDrawTime = 0;
+      if (justChangedStates) {
+        setupDiagScreen();
+        lastDiagDrawTime = 0;
+      }
+      if (millis() - lastDiagDrawTime > 500) {
+        drawDiagScreen();
+        lastDiagDrawTime = millis();
+      }
+      break;
+    }
   }
 
   // process touch
@@ -441,12 +706,15 @@ void screenLoop() {
 
           // Only redraw if button state has changed
           if (htButtons[buttonIndex].isPressed() != wasPressed) {
+            // Tell the ECU before spending time on the redraw
+            htc.sendButtonEdge(buttonIndex, touchSampleUs);
+
             // Track pressed time for potential long press functionality
             if (htButtons[buttonIndex].isPressed()) {
               htButtons[buttonIndex].pressedTime = millis();
             }
             // Redraw button with appropriate state
-            htButtons[buttonIndex].drawButton();
+            htButtons[buttonIndex].invalidate();
           }
           // Long press detected
           if (htButtons[buttonIndex].isPressed() && 
@@ -496,8 +764,8 @@ void screenLoop() {
               case MENU_VAL_SEL:
                 currScreenState = STATE_VAL_SEL;
                 break;
-              case MENU_BUTTON_TEXT_SEL:
-                //currScreenState = STATE_BUTTON_TEXT_SEL;
+              case MENU_DIAG:
+                currScreenState = STATE_DIAG;
                 break;
               case MENU_ALERT_MIN_DOWN: {
                 float increment = pow(10, -buttonToModify->decimalPlaces);
@@ -531,6 +799,10 @@ void screenLoop() {
                 buttonToModify->alertFlashEnabled = !buttonToModify->alertFlashEnabled;
                 drawMenu();
                 break;
+              case MENU_ALERT_STALE:
+                buttonToModify->alertStaleEnabled = !buttonToModify->alertStaleEnabled;
+                drawMenu();
+                break;
               case MENU_DECIMALS_DOWN:
                 if (buttonToModify->decimalPlaces > -2) {
                   buttonToModify->decimalPlaces -= 1;
@@ -565,6 +837,22 @@ void screenLoop() {
                 buttonToModify->mode = BUTTON_MODE_TOGGLE;
                 drawMenu();
                 break;
+              case MENU_WIDGET_NUMBER:
+                buttonToModify->widget = WIDGET_NUMBER;
+                drawMenu();
+                break;
+              case MENU_WIDGET_BAR:
+                buttonToModify->widget = WIDGET_BAR;
+                drawMenu();
+                break;
+              case MENU_WIDGET_SMOOTH_BAR:
+                buttonToModify->widget = WIDGET_SMOOTH_BAR;
+                drawMenu();
+                break;
+              case MENU_WIDGET_GRAPH:
+                buttonToModify->widget = WIDGET_GRAPH;
+                drawMenu();
+                break;
             }
           }
         }
@@ -613,6 +901,27 @@ void screenLoop() {
         break;
       case STATE_BUTTON_TEXT_SEL:
         break;
+      case STATE_DIAG:
+        for (uint8_t buttonIndex = 0; buttonIndex < DIAG_NONE; buttonIndex++) {
+          bool buttonContainsTouch = isValidTouch && diagButtons[buttonIndex].contains(t_x, t_y);
+          diagButtons[buttonIndex].press(buttonContainsTouch);
+
+          if (diagButtons[buttonIndex].justPressed()) {
+            switch (buttonIndex) {
+              case DIAG_BACK:
+                currScreenState = STATE_MENU;
+                break;
+              case DIAG_DISCOVERY:
+                htc.setDiscoveryMode(!htc.isDiscoveryMode());
+                diagButtons[DIAG_DISCOVERY].drawButton(false, "", htc.isDiscoveryMode());
+                break;
+              case DIAG_CLEAR:
+                htc.clearUnknownIds();
+                break;
+            }
+          }
+        }
+        break;
     }
   }
 
@@ -716,7 +1025,9 @@ bool loadLayout(TFT_eSPI &tft) {
         defaultButtonConfigs[i].alertMin,
         defaultButtonConfigs[i].alertMax,
         defaultButtonConfigs[i].alertBeepEnabled,
-        defaultButtonConfigs[i].alertFlashEnabled
+        defaultButtonConfigs[i].alertFlashEnabled,
+        defaultButtonConfigs[i].widget,
+        defaultButtonConfigs[i].alertStaleEnabled
       };
     }
 
@@ -730,33 +1041,74 @@ bool loadLayout(TFT_eSPI &tft) {
     return false;
   }
 
-  // Read entire configuration array
-  layoutFile.read(reinterpret_cast<uint8_t*>(currentButtonConfigs), sizeof(currentButtonConfigs));
+  // Read entire configuration array. Older layouts have shorter records,
+  // whose buttons keep showing a number and get the default stale alert.
+  size_t layoutSize = layoutFile.size();
+  size_t recordSize = 0;
+  if (layoutSize == sizeof(currentButtonConfigs)) {
+    recordSize = sizeof(ButtonConfiguration);
+  } else if (layoutSize == N_BUTTONS * preStaleAlertButtonConfigSize) {
+    Serial.println("Layout from before the stale alert setting, upgrading");
+    recordSize = preStaleAlertButtonConfigSize;
+  } else if (layoutSize == N_BUTTONS * legacyButtonConfigSize) {
+    Serial.println("Layout from before widgets, upgrading");
+    recordSize = legacyButtonConfigSize;
+  }
+
+  if (recordSize > 0) {
+    for (uint8_t i = 0; i < N_BUTTONS; i++) {
+      currentButtonConfigs[i].widget = WIDGET_NUMBER;
+      currentButtonConfigs[i].alertStaleEnabled = STALE_SIGNAL_ALERT;
+      layoutFile.read(reinterpret_cast<uint8_t*>(&currentButtonConfigs[i]), recordSize);
+    }
+  } else {
+    Serial.printf("Layout file is %u bytes, expected %u. Using default.\n", layoutSize, sizeof(currentButtonConfigs));
+    memcpy(currentButtonConfigs, defaultButtonConfigs, sizeof(currentButtonConfigs));
+  }
 
   layoutFile.close();
 
+  // A widget from a newer build this one doesn't know
+  for (uint8_t i = 0; i < N_BUTTONS; i++) {
+    if (currentButtonConfigs[i].widget >= WIDGET_COUNT) {
+      currentButtonConfigs[i].widget = WIDGET_NUMBER;
+    }
+  }
+
+  // A button may show a signal from a DBC that's since been removed
+  for (uint8_t i = 0; i < N_BUTTONS; i++) {
+    if (dashValueAt(currentButtonConfigs[i].displayType) == nullptr) {
+      Serial.printf("Button %u shows unknown signal %u, using its default\n", i, currentButtonConfigs[i].displayType);
+      currentButtonConfigs[i] = defaultButtonConfigs[i];
+    }
+  }
+
   // Set up buttons with saved configuration
   for (uint8_t i = 0; i < N_BUTTONS; i++) {
     htButtons[i].initButton(&tft, 
         i % 4 * TFT_HEIGHT / 4,
         i / 4 * TFT_WIDTH / 4,
-        TFT_HEIGHT / 4-2,
-        TFT_WIDTH / 4-2,
+        DASH_BUTTON_WIDTH,
+        DASH_BUTTON_HEIGHT,
         TFT_GREEN,
         TFT_BLACK,
         TFT_WHITE,
         1,
-        &dashValues[currentButtonConfigs[i].displayType],
+        dashValueAt(currentButtonConfigs[i].displayType),
         currentButtonConfigs[i].displayUnit,
         currentButtonConfigs[i].decimalPlaces,
         currentButtonConfigs[i].mode,
         currentButtonConfigs[i].alertMin,
         currentButtonConfigs[i].alertMax,
         currentButtonConfigs[i].alertBeepEnabled,
-        currentButtonConfigs[i].alertFlashEnabled);
+        currentButtonConfigs[i].alertFlashEnabled,
+        currentButtonConfigs[i].alertStaleEnabled,
+        currentButtonConfigs[i].widget);
     //htButtons[i].drawButton();
   }
 
+  htc.rebuildDispatchTable();
+
   return true;
 }
 
@@ -858,14 +1210,14 @@ void setupSelectValueScreen() {
         
         Serial.printf("init button %d\n", i);
         int index = currentPage * valuesPerPage + i;
-        if (index >= HT_NONE) break; // No more values to display
+        if (index >= dashValueCount()) break; // No more values to display
 
         int x = (i % 2) * (TFT_HEIGHT / 2); // 2 columns
         int y = currentY + (i / 2) * BUTTON_HEIGHT;
 
-        auto drawName = dashValues[index].name;
+        auto drawName = dashValueAt(index)->name;
         if (strlen(drawName) > 20) {
-          drawName = dashValues[index].short_name;
+          drawName = dashValueAt(index)->short_name;
         }
 
         valSelButtons[i].initButtonUL(&tft, x, y,
@@ -893,7 +1245,7 @@ void drawSelectValueScreen() {
 
     // Draw page number to right of "Select Value"
     char pageStr[10];
-    int totalPages = (HT_NONE + valuesPerPage - 1) / valuesPerPage;
+    int totalPages = (dashValueCount() + valuesPerPage - 1) / valuesPerPage;
     sprintf(pageStr, "%d/%d", currentPage + 1, totalPages);
     tft.drawString(pageStr, LEFT_MARGIN + BUTTON_WIDTH * 2.5, currentY + TOP_MARGIN);
 
@@ -906,11 +1258,11 @@ void drawSelectValueScreen() {
     int pageOffset = currentPage * valuesPerPage;
 
     for (int i = VAL_SEL_1; i <= valuesPerPage - 1; i++) {
-      if (i + pageOffset >= HT_NONE) {
+      if (i + pageOffset >= dashValueCount()) {
         break;
       }
       // Serial.printf("drawing val sel button %d with name %s from dashval[%d]\n", i, dashValues[i+pageOffset].name, i);
-      valSelButtons[i].drawButton(false, dashValues[i+pageOffset].name, false);
+      valSelButtons[i].drawButton(false, dashValueAt(i+pageOffset)->name, false);
       int x = (i % 2) * (TFT_HEIGHT / 2); // 2 columns
       int y = currentY + (i / 2) * BUTTON_HEIGHT;
     }
@@ -929,14 +1281,16 @@ void updateButtonConfig(uint8_t buttonToModifyIndex, HaltechButton* buttonToModi
   currentButtonConfigs[buttonToModifyIndex].alertMax = buttonToModify->alertMax;
   currentButtonConfigs[buttonToModifyIndex].alertBeepEnabled = buttonToModify->alertBeepEnabled;
   currentButtonConfigs[buttonToModifyIndex].alertFlashEnabled = buttonToModify->alertFlashEnabled;
+  currentButtonConfigs[buttonToModifyIndex].alertStaleEnabled = buttonToModify->alertStaleEnabled;
+  currentButtonConfigs[buttonToModifyIndex].widget = buttonToModify->widget;
 }
 
 void handleValSelValueSelection(int valueIndex) {
-    // Calculate the actual index in the dashValues array based on the current page
+    // Calculate the actual signal index based on the current page
     int actualIndex = currentPage * valuesPerPage + valueIndex;
 
     // Ensure the index is within bounds
-    if (actualIndex >= HT_NONE) {
+    if (actualIndex >= dashValueCount()) {
         Serial.printf("Invalid value index: %d (actual index: %d)\n", valueIndex, actualIndex);
         return;
     }
@@ -947,7 +1301,7 @@ void handleValSelValueSelection(int valueIndex) {
     currentButtonConfigs[buttonToModifyIndex].displayType = static_cast<HaltechDisplayType_e>(actualIndex);
 
     // Update the button's dashValue to the selected value
-    htButtons[buttonToModifyIndex].dashValue = &dashValues[actualIndex];
+    htButtons[buttonToModifyIndex].dashValue = dashValueAt(actualIndex);
 
     // Change units on the button to get a valid unit
     htButtons[buttonToModifyIndex].changeUnits(DIRECTION_NEXT);
@@ -955,7 +1309,7 @@ void handleValSelValueSelection(int valueIndex) {
     // Update the saved config with the new displayUnit from changeUnits()
     updateButtonConfig(buttonToModifyIndex, &htButtons[buttonToModifyIndex]);
 
-    // Save and reload the layout
+    // Save and reload the layout, which also rebuilds the dispatch table
     saveLayout();
     loadLayout(tft);
 
@@ -964,7 +1318,7 @@ void handleValSelValueSelection(int valueIndex) {
 }
 
 void navigateValSelToNextPage() {
-    if ((currentPage + 1) * valuesPerPage < HT_NONE) {
+    if ((currentPage + 1) * valuesPerPage < dashValueCount()) {
         currentPage++;
         printf("advancing to page %d\n", currentPage);
         drawSelectValueScreen();
@@ -977,4 +1331,65 @@ void navigateValSelToPreviousPage() {
         printf("returning to page %d\n", currentPage);
         drawSelectValueScreen();
     }
-}
\ No newline at end of file
+}
+// Unknown CAN ID table, busiest IDs first. Bytes that have changed between
+// frames are highlighted.
+#define DIAG_ROW_HEIGHT 16
+#define DIAG_TOP (BUTTON_HEIGHT + 4)
+#define DIAG_ROWS ((TFT_WIDTH - DIAG_TOP) / DIAG_ROW_HEIGHT - 1)
+
+void setupDiagScreen() {
+  tft.fillScreen(TFT_BLACK);
+  tft.setTextDatum(TL_DATUM);
+
+  diagButtons[DIAG_BACK].initButtonUL(&tft, 0, 0, BUTTON_WIDTH, BUTTON_HEIGHT, TFT_RED, TFT_BLACK, TFT_WHITE,
+                                      const_cast<char*>("Back"), 1);
+  diagButtons[DIAG_DISCOVERY].initButtonUL(&tft, TFT_HEIGHT - BUTTON_WIDTH*2, 0, BUTTON_WIDTH, BUTTON_HEIGHT, TFT_GREEN, TFT_BLACK, TFT_WHITE,
+                                      const_cast<char*>("Discover"), 1);
+  diagButtons[DIAG_CLEAR].initButtonUL(&tft, TFT_HEIGHT - BUTTON_WIDTH, 0, BUTTON_WIDTH, BUTTON_HEIGHT, TFT_GREEN, TFT_BLACK, TFT_WHITE,
+                                      const_cast<char*>("Clear"), 1);
+
+  diagButtons[DIAG_BACK].drawButton();
+  diagButtons[DIAG_DISCOVERY].drawButton(false, "", htc.isDiscoveryMode());
+  diagButtons[DIAG_CLEAR].drawButton();
+
+  tft.setTextFont(2);
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
+  tft.drawString("Unknown IDs", LEFT_MARGIN + BUTTON_WIDTH, TOP_MARGIN);
+  tft.setTextColor(TFT_DARKGREY, TFT_BLACK);
+  tft.drawString("ID", LEFT_MARGIN, DIAG_TOP);
+  tft.drawString("Count", LEFT_MARGIN + 72, DIAG_TOP);
+  tft.drawString("Hz", LEFT_MARGIN + 136, DIAG_TOP);
+  tft.drawString("Last payload", LEFT_MARGIN + 184, DIAG_TOP);
+}
+
+void drawDiagScreen() {
+  static UnknownIdEntry entries[DIAG_ROWS];
+  uint16_t count = htc.unknownIdSnapshot(entries, DIAG_ROWS);
+
+  tft.setTextFont(2);
+  tft.setTextDatum(TL_DATUM);
+  char text[16];
+  for (uint16_t row = 0; row < DIAG_ROWS; row++) {
+    int y = DIAG_TOP + (row + 1) * DIAG_ROW_HEIGHT;
+    tft.fillRect(0, y, TFT_HEIGHT, DIAG_ROW_HEIGHT, TFT_BLACK);
+    if (row >= count) {
+      continue;
+    }
+
+    const UnknownIdEntry &entry = entries[row];
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    sprintf(text, entry.extended ? "%08X" : "%03X", entry.id);
+    tft.drawString(text, LEFT_MARGIN, y);
+    sprintf(text, "%u", entry.count);
+    tft.drawString(text, LEFT_MARGIN + 72, y);
+    sprintf(text, "%.1f", entry.rateHz());
+    tft.drawString(text, LEFT_MARGIN + 136, y);
+
+    for (uint8_t byteIndex = 0; byteIndex < entry.len; byteIndex++) {
+      tft.setTextColor((entry.changedBytes & (1 << byteIndex)) ? TFT_YELLOW : TFT_WHITE, TFT_BLACK);
+      sprintf(text, "%02X", entry.data[byteIndex]);
+      tft.drawString(text, LEFT_MARGIN + 184 + byteIndex * 32, y);
+    }
+  }
+}
@@ -0,0 +1,197 @@
+#include "sdo_server.h"
+#include <string.h>
+
+// Command specifiers, top 3 bits of byte 0
+#define SDO_CCS_DOWNLOAD_SEGMENT  0
+#define SDO_CCS_INITIATE_DOWNLOAD 1
+#define SDO_CCS_INITIATE_UPLOAD   2
+#define SDO_CCS_UPLOAD_SEGMENT    3
+#define SDO_CCS_ABORT             4
+
+#define SDO_SCS_UPLOAD_SEGMENT    0x00
+#define SDO_SCS_DOWNLOAD_SEGMENT  0x20
+#define SDO_SCS_INITIATE_UPLOAD   0x40
+#define SDO_SCS_INITIATE_DOWNLOAD 0x60
+#define SDO_SCS_ABORT             0x80
+
+#define SDO_TOGGLE_BIT   0x10
+#define SDO_EXPEDITED    0x02
+#define SDO_SIZE_SET     0x01
+#define SDO_LAST_SEGMENT 0x01
+
+static void putUint32(uint8_t *buffer, uint32_t value)
+{
+  buffer[0] = value;
+  buffer[1] = value >> 8;
+  buffer[2] = value >> 16;
+  buffer[3] = value >> 24;
+}
+
+SdoServer::SdoServer()
+    : _dictionary(nullptr), _objectCount(0), _nodeId(0), _deviceIndex(0), _transfer(SDO_IDLE), _object(nullptr)
+{
+}
+
+void SdoServer::begin(uint8_t nodeId, uint8_t deviceIndex, const SdoObject *dictionary, size_t objectCount)
+{
+  _nodeId = nodeId;
+  _deviceIndex = deviceIndex;
+  _dictionary = dictionary;
+  _objectCount = objectCount;
+  _transfer = SDO_IDLE;
+}
+
+const SdoObject *SdoServer::find(uint16_t index, uint8_t subIndex) const
+{
+  uint32_t key = sdoKey(index, subIndex);
+  size_t low = 0;
+  size_t high = _objectCount;
+  while (low < high) {
+    size_t mid = (low + high) / 2;
+    uint32_t midKey = sdoKey(_dictionary[mid].index, _dictionary[mid].subIndex);
+    if (midKey == key) {
+      return &_dictionary[mid];
+    }
+    if (midKey < key) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return nullptr;
+}
+
+uint32_t SdoServer::objectValue(const SdoObject *object) const
+{
+  uint32_t value = object->value;
+  if (object->flags & SDO_ADD_NODE_ID) {
+    value += _nodeId;
+  }
+  if (object->flags & SDO_ADD_DEVICE_INDEX) {
+    value += _deviceIndex;
+  }
+  return value;
+}
+
+void SdoServer::abort(uint8_t *reply, uint16_t index, uint8_t subIndex, uint32_t code)
+{
+  _transfer = SDO_IDLE;
+  reply[0] = SDO_SCS_ABORT;
+  reply[1] = index;
+  reply[2] = index >> 8;
+  reply[3] = subIndex;
+  putUint32(&reply[4], code);
+}
+
+bool SdoServer::handleRequest(const uint8_t *request, uint8_t len, uint8_t *reply)
+{
+  memset(reply, 0, 8);
+  if (len < 8) {
+    return false;
+  }
+
+  uint16_t index = request[1] | (request[2] << 8);
+  uint8_t subIndex = request[3];
+
+  switch (request[0] >> 5) {
+    case SDO_CCS_INITIATE_DOWNLOAD:
+      // Expedited writes carry their data here; segmented ones follow in
+      // download segments. Either way nothing is stored.
+      _transfer = (request[0] & SDO_EXPEDITED) ? SDO_IDLE : SDO_DOWNLOAD;
+      _index = index;
+      _subIndex = subIndex;
+      _toggle = 0;
+      reply[0] = SDO_SCS_INITIATE_DOWNLOAD;
+      memcpy(&reply[1], &request[1], 3);
+      return true;
+
+    case SDO_CCS_DOWNLOAD_SEGMENT:
+      return downloadSegment(request, reply);
+
+    case SDO_CCS_INITIATE_UPLOAD:
+      return initiateUpload(index, subIndex, reply);
+
+    case SDO_CCS_UPLOAD_SEGMENT:
+      return uploadSegment(request, reply);
+
+    case SDO_CCS_ABORT:
+      _transfer = SDO_IDLE;
+      return false;
+
+    default:
+      // Block transfers
+      abort(reply, index, subIndex, SDO_ABORT_COMMAND);
+      return true;
+  }
+}
+
+bool SdoServer::initiateUpload(uint16_t index, uint8_t subIndex, uint8_t *reply)
+{
+  const SdoObject *object = find(index, subIndex);
+  reply[1] = index;
+  reply[2] = index >> 8;
+  reply[3] = subIndex;
+
+  if (object == nullptr || object->size <= 4) {
+    // Expedited, always 4 bytes like the original keypad
+    _transfer = SDO_IDLE;
+    reply[0] = SDO_SCS_INITIATE_UPLOAD | SDO_EXPEDITED | SDO_SIZE_SET;
+    putUint32(&reply[4], object != nullptr ? objectValue(object) : 0);
+    return true;
+  }
+
+  _transfer = SDO_UPLOAD;
+  _object = object;
+  _index = index;
+  _subIndex = subIndex;
+  _offset = 0;
+  _toggle = 0;
+  reply[0] = SDO_SCS_INITIATE_UPLOAD | SDO_SIZE_SET;
+  putUint32(&reply[4], object->size);
+  return true;
+}
+
+bool SdoServer::uploadSegment(const uint8_t *request, uint8_t *reply)
+{
+  if (_transfer != SDO_UPLOAD) {
+    abort(reply, 0, 0, SDO_ABORT_COMMAND);
+    return true;
+  }
+  if ((request[0] & SDO_TOGGLE_BIT) != _toggle) {
+    abort(reply, _index, _subIndex, SDO_ABORT_TOGGLE);
+    return true;
+  }
+
+  uint16_t remaining = _object->size - _offset;
+  uint8_t segmentLength = remaining > 7 ? 7 : remaining;
+  memcpy(&reply[1], _object->data + _offset, segmentLength);
+  _offset += segmentLength;
+
+  // n counts the unused bytes at the end of the segment
+  reply[0] = SDO_SCS_UPLOAD_SEGMENT | _toggle | ((7 - segmentLength) << 1);
+  if (_offset == _object->size) {
+    reply[0] |= SDO_LAST_SEGMENT;
+    _transfer = SDO_IDLE;
+  }
+  _toggle ^= SDO_TOGGLE_BIT;
+  return true;
+}
+
+bool SdoServer::downloadSegment(const uint8_t *request, uint8_t *reply)
+{
+  if (_transfer != SDO_DOWNLOAD) {
+    abort(reply, 0, 0, SDO_ABORT_COMMAND);
+    return true;
+  }
+  if ((request[0] & SDO_TOGGLE_BIT) != _toggle) {
+    abort(reply, _index, _subIndex, SDO_ABORT_TOGGLE);
+    return true;
+  }
+
+  reply[0] = SDO_SCS_DOWNLOAD_SEGMENT | _toggle;
+  if (request[0] & SDO_LAST_SEGMENT) {
+    _transfer = SDO_IDLE;
+  }
+  _toggle ^= SDO_TOGGLE_BIT;
+  return true;
+}
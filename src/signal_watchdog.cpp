@@ -0,0 +1,100 @@
+#include "signal_watchdog.h"
+#include <string.h>
+
+SignalWatchdog::SignalWatchdog()
+    : _currentTick(0)
+{
+  memset(_slotHead, 0xFF, sizeof(_slotHead));
+  memset(_scheduled, 0, sizeof(_scheduled));
+  memset(_stale, 0, sizeof(_stale));
+}
+
+void SignalWatchdog::link(uint16_t signal)
+{
+  uint16_t slot = (_deadline[signal] / TICK_MS) % SLOT_COUNT;
+  _prev[signal] = NONE;
+  _next[signal] = _slotHead[slot];
+  if (_slotHead[slot] != NONE) {
+    _prev[_slotHead[slot]] = signal;
+  }
+  _slotHead[slot] = signal;
+  _scheduled[signal] = true;
+}
+
+void SignalWatchdog::unlink(uint16_t signal)
+{
+  if (_prev[signal] != NONE) {
+    _next[_prev[signal]] = _next[signal];
+  } else {
+    _slotHead[(_deadline[signal] / TICK_MS) % SLOT_COUNT] = _next[signal];
+  }
+  if (_next[signal] != NONE) {
+    _prev[_next[signal]] = _prev[signal];
+  }
+  _scheduled[signal] = false;
+}
+
+bool SignalWatchdog::refresh(uint16_t signal, unsigned long now, unsigned long timeoutMs)
+{
+  if (signal >= MAX_SIGNALS) {
+    return false;
+  }
+
+  if (_scheduled[signal]) {
+    unlink(signal);
+  }
+
+  // Keep the deadline at least one tick out so it lands in a slot that
+  // expire() hasn't passed yet
+  if (timeoutMs < TICK_MS) {
+    timeoutMs = TICK_MS;
+  }
+  _deadline[signal] = now + timeoutMs;
+
+  // now is when the frame was decoded, which can be behind the last
+  // expire() when the UI loop lags. A slot already passed would only come
+  // round again a whole wheel later, so use the next one instead.
+  unsigned long earliest = (_currentTick + 1) * TICK_MS;
+  if ((long)(_deadline[signal] - earliest) < 0) {
+    _deadline[signal] = earliest;
+  }
+  link(signal);
+
+  bool wasStale = _stale[signal];
+  _stale[signal] = false;
+  return wasStale;
+}
+
+uint16_t SignalWatchdog::expire(unsigned long now, uint16_t *expired, uint16_t maxExpired)
+{
+  uint16_t expiredCount = 0;
+  unsigned long nowTick = now / TICK_MS;
+
+  // After a long gap every slot is due, so one pass over the wheel is enough
+  unsigned long firstTick = _currentTick + 1;
+  if (nowTick - _currentTick > SLOT_COUNT) {
+    firstTick = nowTick - SLOT_COUNT + 1;
+  }
+
+  for (unsigned long tick = firstTick; tick <= nowTick; tick++) {
+    uint16_t signal = _slotHead[tick % SLOT_COUNT];
+    while (signal != NONE) {
+      uint16_t next = _next[signal];
+
+      // Deadlines more than one wheel revolution away wait for a later pass
+      if ((long)(now - _deadline[signal]) >= 0) {
+        if (expiredCount == maxExpired) {
+          _currentTick = tick - 1;
+          return expiredCount;
+        }
+        unlink(signal);
+        _stale[signal] = true;
+        expired[expiredCount++] = signal;
+      }
+      signal = next;
+    }
+  }
+
+  _currentTick = nowTick;
+  return expiredCount;
+}
@@ -0,0 +1,266 @@
+#ifdef __linux__
+
+#include "socketcan_transport.h"
+#include "esp_timer.h"
+#include <string.h>
+#include <vector>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/can.h>
+#include <linux/can/error.h>
+#include <linux/can/netlink.h>
+#include <linux/can/raw.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/sockios.h>
+
+SocketCanTransport::SocketCanTransport(const char *interfaceName)
+    : _socket(-1), _rxMissed(0), _txFailed(0), _lastTxDoneUs(0), _busOffCount(0), _busOff(false)
+{
+  strncpy(_interfaceName, interfaceName, sizeof(_interfaceName) - 1);
+  _interfaceName[sizeof(_interfaceName) - 1] = '\0';
+}
+
+SocketCanTransport::~SocketCanTransport()
+{
+  closeSocket();
+}
+
+void SocketCanTransport::closeSocket()
+{
+  if (_socket >= 0) {
+    close(_socket);
+    _socket = -1;
+  }
+}
+
+bool SocketCanTransport::begin(long bitrate, const CanAcceptanceFilter &filter, const uint16_t *ids, uint16_t idCount)
+{
+  closeSocket();
+
+  _socket = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+  if (_socket < 0) {
+    perror("SocketCAN socket");
+    return false;
+  }
+
+  struct ifreq ifr;
+  memset(&ifr, 0, sizeof(ifr));
+  strncpy(ifr.ifr_name, _interfaceName, IFNAMSIZ - 1);
+  if (ioctl(_socket, SIOCGIFINDEX, &ifr) < 0) {
+    fprintf(stderr, "SocketCAN: no interface %s\n", _interfaceName);
+    closeSocket();
+    return false;
+  }
+
+  if (!checkBitrate(ifr.ifr_ifindex, bitrate)) {
+    closeSocket();
+    return false;
+  }
+
+  // The kernel filters on the exact IDs, so the TWAI code/mask isn't needed.
+  // With accept-everything, or no IDs to filter for, the socket keeps its
+  // default of receiving all and HaltechCan rejects in software, rather
+  // than an empty filter list receiving nothing.
+  if (!(filter.single && filter.mask == 0xFFFFFFFF) && idCount > 0) {
+    std::vector<struct can_filter> filters(idCount);
+    for (uint16_t i = 0; i < idCount; i++) {
+      filters[i].can_id = ids[i];
+      filters[i].can_mask = CAN_SFF_MASK | CAN_EFF_FLAG | CAN_RTR_FLAG;
+    }
+    if (setsockopt(_socket, SOL_CAN_RAW, CAN_RAW_FILTER, filters.data(), idCount * sizeof(struct can_filter)) < 0) {
+      perror("SocketCAN filter");
+      closeSocket();
+      return false;
+    }
+  }
+
+  // Bus-off is reported as an error frame; the kernel restarts the
+  // controller itself if the interface has restart-ms set
+  can_err_mask_t errorMask = CAN_ERR_BUSOFF | CAN_ERR_RESTARTED;
+  setsockopt(_socket, SOL_CAN_RAW, CAN_RAW_ERR_FILTER, &errorMask, sizeof(errorMask));
+
+  int enable = 1;
+  setsockopt(_socket, SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable));
+  fcntl(_socket, F_SETFL, fcntl(_socket, F_GETFL) | O_NONBLOCK);
+
+  struct sockaddr_can addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.can_family = AF_CAN;
+  addr.can_ifindex = ifr.ifr_ifindex;
+  if (bind(_socket, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+    perror("SocketCAN bind");
+    closeSocket();
+    return false;
+  }
+
+  return true;
+}
+
+static struct rtattr *findAttribute(struct rtattr *attr, int length, unsigned short type)
+{
+  for (; RTA_OK(attr, length); attr = RTA_NEXT(attr, length)) {
+    if (attr->rta_type == type) {
+      return attr;
+    }
+  }
+  return nullptr;
+}
+
+// Real interfaces report their bit timing over rtnetlink; vcan has none,
+// so any bitrate goes
+bool SocketCanTransport::checkBitrate(int ifIndex, long bitrate)
+{
+  int netlink = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
+  if (netlink < 0) {
+    perror("SocketCAN netlink");
+    return false;
+  }
+
+  struct
+  {
+    struct nlmsghdr header;
+    struct ifinfomsg info;
+  } request;
+  memset(&request, 0, sizeof(request));
+  request.header.nlmsg_len = sizeof(request);
+  request.header.nlmsg_type = RTM_GETLINK;
+  request.header.nlmsg_flags = NLM_F_REQUEST;
+  request.info.ifi_family = AF_UNSPEC;
+  request.info.ifi_index = ifIndex;
+
+  char reply[8192];
+  ssize_t replyLength = -1;
+  if (::send(netlink, &request, sizeof(request), 0) == sizeof(request)) {
+    replyLength = ::recv(netlink, reply, sizeof(reply), 0);
+  }
+  close(netlink);
+
+  struct nlmsghdr *header = (struct nlmsghdr *)reply;
+  if (replyLength < 0 || !NLMSG_OK(header, (size_t)replyLength) || header->nlmsg_type != RTM_NEWLINK) {
+    fprintf(stderr, "SocketCAN: can't read the settings of %s\n", _interfaceName);
+    return false;
+  }
+
+  // IFLA_LINKINFO > IFLA_INFO_DATA > IFLA_CAN_BITTIMING
+  struct rtattr *linkInfo = findAttribute(IFLA_RTA(NLMSG_DATA(header)), IFLA_PAYLOAD(header), IFLA_LINKINFO);
+  struct rtattr *infoData = linkInfo != nullptr ? findAttribute((struct rtattr *)RTA_DATA(linkInfo), RTA_PAYLOAD(linkInfo), IFLA_INFO_DATA) : nullptr;
+  struct rtattr *timingAttr = infoData != nullptr ? findAttribute((struct rtattr *)RTA_DATA(infoData), RTA_PAYLOAD(infoData), IFLA_CAN_BITTIMING) : nullptr;
+  if (timingAttr == nullptr || RTA_PAYLOAD(timingAttr) < sizeof(struct can_bittiming)) {
+    return true;
+  }
+
+  const struct can_bittiming *timing = (const struct can_bittiming *)RTA_DATA(timingAttr);
+  if (timing->bitrate != 0 && (long)timing->bitrate != bitrate) {
+    fprintf(stderr, "SocketCAN: %s runs at %u bit/s, the dash wants %ld. Set it with\n"
+                    "  ip link set %s down; ip link set %s type can bitrate %ld; ip link set %s up\n",
+            _interfaceName, timing->bitrate, bitrate, _interfaceName, _interfaceName, bitrate, _interfaceName);
+    return false;
+  }
+  return true;
+}
+
+bool SocketCanTransport::waitForFrames(uint32_t timeoutMs)
+{
+  struct pollfd pfd = {_socket, POLLIN, 0};
+  return poll(&pfd, 1, timeoutMs) > 0 && (pfd.revents & POLLIN);
+}
+
+bool SocketCanTransport::receive(CanFrame &frame)
+{
+  struct can_frame canFrame;
+  char control[CMSG_SPACE(sizeof(uint32_t))];
+  struct iovec iov = {&canFrame, sizeof(canFrame)};
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  while (recvmsg(_socket, &msg, 0) == sizeof(canFrame)) {
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+      if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL) {
+        memcpy(&_rxMissed, CMSG_DATA(cmsg), sizeof(_rxMissed));
+      }
+    }
+
+    if (canFrame.can_id & CAN_ERR_FLAG) {
+      if (canFrame.can_id & CAN_ERR_BUSOFF) {
+        _busOffCount++;
+        _busOff = true;
+      }
+      if (canFrame.can_id & CAN_ERR_RESTARTED) {
+        _busOff = false;
+      }
+    }
+    if (canFrame.can_id & (CAN_ERR_FLAG | CAN_RTR_FLAG)) {
+      msg.msg_controllen = sizeof(control);
+      continue;
+    }
+
+    frame.extended = canFrame.can_id & CAN_EFF_FLAG;
+    frame.id = canFrame.can_id & (frame.extended ? CAN_EFF_MASK : CAN_SFF_MASK);
+    frame.len = canFrame.can_dlc > 8 ? 8 : canFrame.can_dlc;
+    memcpy(frame.data, canFrame.data, frame.len);
+    return true;
+  }
+  return false;
+}
+
+bool SocketCanTransport::send(const CanFrame &frame, uint32_t timeoutMs)
+{
+  struct can_frame canFrame;
+  memset(&canFrame, 0, sizeof(canFrame));
+  canFrame.can_id = frame.extended ? (frame.id | CAN_EFF_FLAG) : frame.id;
+  canFrame.can_dlc = frame.len;
+  memcpy(canFrame.data, frame.data, frame.len);
+
+  struct pollfd pfd = {_socket, POLLOUT, 0};
+  if (poll(&pfd, 1, timeoutMs) <= 0) {
+    return false;
+  }
+  if (write(_socket, &canFrame, sizeof(canFrame)) != sizeof(canFrame)) {
+    _txFailed++;
+    return false;
+  }
+
+  // The kernel queues the frame straight to the device, which is as close
+  // to on-the-wire as userspace gets
+  _lastTxDoneUs = esp_timer_get_time();
+  return true;
+}
+
+void SocketCanTransport::clearReceiveQueue()
+{
+  CanFrame frame;
+  while (receive(frame)) {
+  }
+}
+
+bool SocketCanTransport::getStatus(CanTransportStatus &status)
+{
+  int pendingBytes = 0;
+  if (_socket < 0 || ioctl(_socket, SIOCINQ, &pendingBytes) < 0) {
+    return false;
+  }
+
+  status.rxPending = pendingBytes / sizeof(struct can_frame);
+  status.rxMissed = _rxMissed;
+  status.rxOverrun = 0;
+  status.rxQueueFullEvents = 0;
+  status.txPending = 0;
+  status.lastTxDoneUs = _lastTxDoneUs;
+  status.txFailed = _txFailed;
+  status.busOffCount = _busOffCount;
+  status.busOff = _busOff;
+  return true;
+}
+
+#endif // __linux__
@@ -0,0 +1,151 @@
+#include "twai_transport.h"
+#include <Arduino.h>
+#include "driver/twai.h"
+#include "esp_timer.h"
+
+static const twai_timing_config_t timing125k = TWAI_TIMING_CONFIG_125KBITS();
+static const twai_timing_config_t timing250k = TWAI_TIMING_CONFIG_250KBITS();
+static const twai_timing_config_t timing500k = TWAI_TIMING_CONFIG_500KBITS();
+static const twai_timing_config_t timing1M = TWAI_TIMING_CONFIG_1MBITS();
+
+TwaiTransport::TwaiTransport(gpio_num_t txPin, gpio_num_t rxPin)
+    : _txPin(txPin), _rxPin(rxPin), _rxQueueFullEvents(0), _busOffCount(0), _busOff(false), _lastTxDoneUs(0)
+{
+}
+
+bool TwaiTransport::begin(long bitrate, const CanAcceptanceFilter &filter, const uint16_t *ids, uint16_t idCount)
+{
+  // First, uninstall any existing driver
+  twai_stop();
+  twai_driver_uninstall();
+
+  twai_general_config_t g_config = TWAI_GENERAL_CONFIG_DEFAULT(_txPin, _rxPin, TWAI_MODE_NORMAL);
+
+  // Enable RX data, TX completion and bus health alerts
+  g_config.alerts_enabled = TWAI_ALERT_RX_DATA | TWAI_ALERT_RX_QUEUE_FULL | TWAI_ALERT_TX_SUCCESS | TWAI_ALERT_BUS_OFF | TWAI_ALERT_BUS_RECOVERED;
+  g_config.rx_queue_len = 100;
+
+  twai_timing_config_t t_config;
+  switch (bitrate) {
+    case 125000: t_config = timing125k; break;
+    case 250000: t_config = timing250k; break;
+    case 500000: t_config = timing500k; break;
+    case 1000000: t_config = timing1M; break;
+    default:
+      Serial.printf("Unsupported CAN bitrate %ld\n", bitrate);
+      return false;
+  }
+
+  twai_filter_config_t f_config;
+  f_config.acceptance_code = filter.code;
+  f_config.acceptance_mask = filter.mask;
+  f_config.single_filter = filter.single;
+
+  // Install TWAI driver
+  esp_err_t install_err = twai_driver_install(&g_config, &t_config, &f_config);
+  if (install_err != ESP_OK) {
+    Serial.printf("Failed to install driver. Error code: 0x%x\n", install_err);
+    return false;
+  }
+
+  // Start TWAI driver
+  if (twai_start() == ESP_OK) {
+    _busOff = false;
+    Serial.printf("Driver started\n");
+  } else {
+    Serial.printf("Failed to start driver\n");
+    twai_driver_uninstall();
+    return false;
+  }
+
+  return true;
+}
+
+bool TwaiTransport::waitForFrames(uint32_t timeoutMs)
+{
+  uint32_t alerts;
+  if (twai_read_alerts(&alerts, pdMS_TO_TICKS(timeoutMs)) != ESP_OK) {
+    return false;
+  }
+
+  if (alerts & TWAI_ALERT_TX_SUCCESS) {
+    // The alert wakes this wait as soon as a frame is acked, so this is
+    // close to when it left the wire
+    _lastTxDoneUs = esp_timer_get_time();
+  }
+  if (alerts & TWAI_ALERT_RX_QUEUE_FULL) {
+    // Keep draining rather than clearing the queue so no more frames are lost
+    _rxQueueFullEvents++;
+  }
+  if (alerts & TWAI_ALERT_BUS_OFF) {
+    // Too many transmit errors, e.g. the ECU is off and nothing acks our
+    // frames. The controller needs 128 recessive sequences before it can
+    // start again.
+    _busOffCount++;
+    _busOff = true;
+    Serial.printf("CAN bus-off, recovering\n");
+    twai_initiate_recovery();
+  }
+  if (alerts & TWAI_ALERT_BUS_RECOVERED) {
+    // Recovery leaves the driver stopped
+    if (twai_start() == ESP_OK) {
+      _busOff = false;
+      Serial.printf("CAN bus recovered\n");
+    }
+  }
+  bool rxData = alerts & TWAI_ALERT_RX_DATA;
+  alerts &= ~(TWAI_ALERT_RX_DATA | TWAI_ALERT_RX_QUEUE_FULL | TWAI_ALERT_TX_SUCCESS | TWAI_ALERT_BUS_OFF | TWAI_ALERT_BUS_RECOVERED);
+  if (alerts) {
+    Serial.printf("Alerts: 0x%04x\n", alerts);
+  }
+  return rxData;
+}
+
+bool TwaiTransport::receive(CanFrame &frame)
+{
+  twai_message_t message;
+  if (twai_receive(&message, 0) != ESP_OK) {
+    return false;
+  }
+
+  frame.id = message.identifier;
+  frame.extended = message.extd;
+  frame.len = message.data_length_code > 8 ? 8 : message.data_length_code;
+  memcpy(frame.data, message.data, frame.len);
+  return true;
+}
+
+bool TwaiTransport::send(const CanFrame &frame, uint32_t timeoutMs)
+{
+  twai_message_t message = {};
+  message.identifier = frame.id;
+  message.extd = frame.extended ? 1 : 0;
+  message.data_length_code = frame.len;
+  memcpy(message.data, frame.data, frame.len);
+
+  return twai_transmit(&message, pdMS_TO_TICKS(timeoutMs)) == ESP_OK;
+}
+
+void TwaiTransport::clearReceiveQueue()
+{
+  twai_clear_receive_queue();
+}
+
+bool TwaiTransport::getStatus(CanTransportStatus &status)
+{
+  twai_status_info_t info;
+  if (twai_get_status_info(&info) != ESP_OK) {
+    return false;
+  }
+
+  status.rxPending = info.msgs_to_rx;
+  status.rxMissed = info.rx_missed_count;
+  status.rxOverrun = info.rx_overrun_count;
+  status.rxQueueFullEvents = _rxQueueFullEvents;
+  status.txPending = info.msgs_to_tx;
+  status.lastTxDoneUs = _lastTxDoneUs;
+  status.txFailed = info.tx_failed_count;
+  status.busOffCount = _busOffCount;
+  status.busOff = _busOff;
+  return true;
+}
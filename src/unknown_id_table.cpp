@@ -0,0 +1,96 @@
+#include "unknown_id_table.h"
+#include <string.h>
+
+UnknownIdTable::UnknownIdTable()
+{
+  clear();
+}
+
+void UnknownIdTable::clear()
+{
+  memset(_keys, 0, sizeof(_keys));
+  _size = 0;
+  _overflowCount = 0;
+}
+
+uint16_t UnknownIdTable::slotFor(uint32_t key)
+{
+  // Fibonacci hashing spreads the clustered IDs of a broadcast group
+  return (key * 2654435769u) >> (32 - 7);
+}
+
+void UnknownIdTable::record(uint32_t id, bool extended, uint8_t len, const uint8_t *data, int64_t nowUs)
+{
+  static_assert((CAPACITY & (CAPACITY - 1)) == 0 && CAPACITY == 1 << 7, "slotFor() assumes 128 slots");
+
+  uint32_t key = KEY_USED | (extended ? KEY_EXTENDED : 0) | id;
+  if (len > 8) {
+    len = 8;
+  }
+
+  // Nothing is ever removed but by clear(), so an ID that was inserted is
+  // within MAX_PROBE slots of where it hashes
+  uint16_t slot = slotFor(key);
+  for (uint8_t probe = 0; probe < MAX_PROBE; probe++, slot = (slot + 1) & (CAPACITY - 1)) {
+    UnknownIdEntry *entry = &_entries[slot];
+
+    if (_keys[slot] == key) {
+      for (uint8_t i = 0; i < len; i++) {
+        if (i >= entry->len || entry->data[i] != data[i]) {
+          entry->changedBytes |= 1 << i;
+        }
+      }
+      memcpy(entry->data, data, len);
+      entry->len = len;
+      entry->count++;
+      entry->lastSeenUs = nowUs;
+      return;
+    }
+
+    if (_keys[slot] == 0) {
+      if (_size >= MAX_SIZE) {
+        break;
+      }
+      entry->id = id;
+      entry->extended = extended;
+      entry->len = len;
+      memcpy(entry->data, data, len);
+      entry->changedBytes = 0;
+      entry->count = 1;
+      entry->firstSeenUs = nowUs;
+      entry->lastSeenUs = nowUs;
+      _keys[slot] = key;
+      _size++;
+      return;
+    }
+  }
+
+  _overflowCount++;
+}
+
+uint16_t UnknownIdTable::snapshot(UnknownIdEntry *out, uint16_t maxEntries) const
+{
+  // Insertion sort on count; maxEntries is a screenful or so
+  uint16_t copied = 0;
+  for (uint16_t slot = 0; slot < CAPACITY; slot++) {
+    if (_keys[slot] == 0) {
+      continue;
+    }
+
+    const UnknownIdEntry &entry = _entries[slot];
+    uint16_t position = copied;
+    while (position > 0 && out[position - 1].count < entry.count) {
+      if (position < maxEntries) {
+        out[position] = out[position - 1];
+      }
+      position--;
+    }
+    if (position < maxEntries) {
+      out[position] = entry;
+      if (copied < maxEntries) {
+        copied++;
+      }
+    }
+  }
+  return copied;
+}
@@ -0,0 +1,207 @@
+#include "value_renderer.h"
+#include "esp_timer.h"
+#include <string.h>
+
+static const char glyphChars[] = VALUE_GLYPH_CHARS;
+static_assert(sizeof(glyphChars) - 1 == VALUE_GLYPH_COUNT, "VALUE_GLYPH_COUNT doesn't match VALUE_GLYPH_CHARS");
+
+ValueRenderer::ValueRenderer(CountingTFT *tft)
+    : _tft(tft),
+      _sprites{TFT_eSprite(tft), TFT_eSprite(tft)},
+      _glyphs{TFT_eSprite(tft), TFT_eSprite(tft), TFT_eSprite(tft)},
+      _schemes{}
+{
+}
+
+bool ValueRenderer::begin(int16_t width, int16_t height, const GFXfont *font)
+{
+  for (uint8_t i = 0; i < 2; i++) {
+    _sprites[i].setColorDepth(16);
+    if (_sprites[i].createSprite(width, height) == nullptr) {
+      Serial.printf("Value sprite %ux%u allocation failed, drawing values directly\n", width, height);
+      _sprites[0].deleteSprite();
+      return false;
+    }
+  }
+  _width = width;
+  _height = height;
+  _font = font;
+
+#if defined(ESP32_DMA)
+  _dma = _tft->initDMA();
+#endif
+  Serial.printf("Value sprites: 2 x %ux%u (%u B), %s\n", width, height, 2 * width * height * 2, _dma ? "DMA" : "blocking push");
+
+  setupGlyphs();
+
+  _ready = true;
+  return true;
+}
+
+// The atlas needs every character to have the same advance so cells line
+// up with where drawString would have put them. textWidth() measures a
+// string's last character by its ink rather than its advance, so each
+// advance is what a character adds in front of a "0".
+void ValueRenderer::setupGlyphs()
+{
+  _tft->setFreeFont(_font);
+  int16_t zeroWidth = _tft->textWidth("0");
+  int16_t cellWidth = _tft->textWidth("00") - zeroWidth;
+  for (uint8_t i = 0; i < VALUE_GLYPH_COUNT; i++) {
+    char glyph[3] = {glyphChars[i], '0', '\0'};
+    if (_tft->textWidth(glyph) - zeroWidth != cellWidth) {
+      Serial.printf("Value font isn't monospaced, no glyph atlas\n");
+      return;
+    }
+  }
+
+  for (uint8_t i = 0; i < VALUE_GLYPH_SCHEMES; i++) {
+    _glyphs[i].setColorDepth(16);
+    if (_glyphs[i].createSprite(cellWidth, _height * VALUE_GLYPH_COUNT) == nullptr) {
+      Serial.printf("Glyph atlas allocation failed\n");
+      for (uint8_t created = 0; created < i; created++) {
+        _glyphs[created].deleteSprite();
+      }
+      return;
+    }
+  }
+  _cellWidth = cellWidth;
+  Serial.printf("Glyph atlas: %u schemes x %u glyphs of %ux%u (%u B)\n", VALUE_GLYPH_SCHEMES, VALUE_GLYPH_COUNT,
+                cellWidth, _height, VALUE_GLYPH_SCHEMES * VALUE_GLYPH_COUNT * cellWidth * _height * 2);
+}
+
+// Rendered on first use, replacing the oldest scheme once all are in use
+const uint16_t *ValueRenderer::glyphScheme(uint16_t textColor, uint16_t fillColor)
+{
+  for (uint8_t i = 0; i < VALUE_GLYPH_SCHEMES; i++) {
+    if (_schemes[i].built && _schemes[i].textColor == textColor && _schemes[i].fillColor == fillColor) {
+      return (const uint16_t *)_glyphs[i].getPointer();
+    }
+  }
+
+  // A DMA push may still be reading the cells about to be overwritten
+  finish();
+  uint8_t slot = _nextScheme;
+  _nextScheme = (_nextScheme + 1) % VALUE_GLYPH_SCHEMES;
+  TFT_eSprite &atlas = _glyphs[slot];
+  atlas.fillSprite(fillColor);
+  atlas.setFreeFont(_font);
+  atlas.setTextColor(textColor, fillColor);
+  // From the left of the cell, as the glyph sits within a string
+  atlas.setTextDatum(ML_DATUM);
+  for (uint8_t i = 0; i < VALUE_GLYPH_COUNT; i++) {
+    char glyph[2] = {glyphChars[i], '\0'};
+    atlas.drawString(glyph, 0, i * _height + _height / 2);
+  }
+  _schemes[slot] = {textColor, fillColor, true};
+  return (const uint16_t *)atlas.getPointer();
+}
+
+void ValueRenderer::draw(int16_t x, int16_t y, int16_t textX, const char *text, uint16_t textColor, uint16_t fillColor)
+{
+  // With DMA this sprite's last push finished before the other one's
+  // started, so it's free to draw into
+  TFT_eSprite &sprite = _sprites[_next];
+  sprite.fillSprite(fillColor);
+  sprite.setFreeFont(_font);
+  sprite.setTextColor(textColor, fillColor);
+  sprite.setTextDatum(MC_DATUM);
+  sprite.drawString(text, textX, _height / 2);
+
+  push(x, y, _width, _height, (uint16_t *)sprite.getPointer());
+  _next ^= 1;
+}
+
+void ValueRenderer::drawCells(int16_t x, int16_t y, int16_t textX, const char *text, const char *previous, uint16_t textColor, uint16_t fillColor)
+{
+  size_t length = strlen(text);
+  int16_t textWidth = length * _cellWidth;
+  int16_t start = textX - textWidth / 2;
+  if (!hasGlyphs() || start < 0 || start + textWidth > _width) {
+    draw(x, y, textX, text, textColor, fillColor);
+    return;
+  }
+
+  // A change of length moves every cell, so it's drawn like a new value
+  if (previous != nullptr && strlen(previous) != length) {
+    previous = nullptr;
+  }
+  if (previous == nullptr) {
+    finish();
+    fill(x, y, start, _height, fillColor);
+    fill(x + start + textWidth, y, _width - start - textWidth, _height, fillColor);
+  }
+
+  const uint16_t *atlas = glyphScheme(textColor, fillColor);
+  for (size_t i = 0; i < length; i++) {
+    if (previous != nullptr && previous[i] == text[i]) {
+      continue;
+    }
+    const char *glyph = strchr(glyphChars, text[i]);
+    if (glyph == nullptr) {
+      fill(x + start + i * _cellWidth, y, _cellWidth, _height, fillColor);
+      continue;
+    }
+    uint16_t *cell = (uint16_t *)atlas + (glyph - glyphChars) * _cellWidth * _height;
+    push(x + start + i * _cellWidth, y, _cellWidth, _height, cell);
+  }
+}
+
+// Sprite pixels are stored byte swapped, ready to send as they are
+void ValueRenderer::push(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pixels)
+{
+  int64_t startUs = esp_timer_get_time();
+  _spiBytes += PANEL_WINDOW_BYTES + (uint32_t)w * h * PANEL_BYTES_PER_PIXEL;
+  _tft->countWindow(x, y, w, h);
+#if defined(ESP32_DMA)
+  if (_dma) {
+    // Chip select stays low from the first push until finish()
+    if (!_pushPending) {
+      _tft->startWrite();
+    }
+    // Waits for the previous push, then returns as soon as this one starts
+    _tft->pushImageDMA(x, y, w, h, pixels);
+    _pushPending = true;
+    _blockedUs += esp_timer_get_time() - startUs;
+    return;
+  }
+#endif
+  bool swapBytes = _tft->getSwapBytes();
+  _tft->setSwapBytes(false);
+  _tft->pushImage(x, y, w, h, pixels);
+  _tft->setSwapBytes(swapBytes);
+  _blockedUs += esp_timer_get_time() - startUs;
+}
+
+void ValueRenderer::fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+  int64_t startUs = esp_timer_get_time();
+  _spiBytes += PANEL_WINDOW_BYTES + (uint32_t)w * h * PANEL_BYTES_PER_PIXEL;
+  _tft->fillRect(x, y, w, h, color);
+  _blockedUs += esp_timer_get_time() - startUs;
+}
+
+void ValueRenderer::finish()
+{
+#if defined(ESP32_DMA)
+  if (!_pushPending) {
+    return;
+  }
+  int64_t startUs = esp_timer_get_time();
+  _tft->dmaWait();
+  _tft->endWrite();
+  _pushPending = false;
+  _blockedUs += esp_timer_get_time() - startUs;
+#endif
+}
+
+void ValueRenderer::takeStats(uint32_t &blockedUs, uint32_t &spiBytes)
+{
+  blockedUs = _blockedUs;
+  spiBytes = _spiBytes;
+  _blockedUs = 0;
+  _spiBytes = 0;
+}
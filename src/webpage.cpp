@@ -4,6 +4,7 @@
 #include <ESPmDNS.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
+#include <StreamString.h>
 #include "screen.h"
 
 std::vector<WiFiClient> sseClients;
@@ -110,6 +111,20 @@ void handleUpdateUpload() {
   }
 }
 
+void handleCanStats() {
+  StreamString stats;
+  htc.printDecodeStats(stats);
+  htc.printIdStats(stats);
+  htc.printTxStats(stats);
+  server.send(200, "text/plain", stats);
+}
+
+void handleUnknownIds() {
+  StreamString table;
+  htc.printUnknownIds(table);
+  server.send(200, "text/plain", table);
+}
+
 void handleNotFound() {
   server.send(404, "text/plain", "404: Not Found");
 }
@@ -196,6 +211,8 @@ void createAccessPoint() {
   server.on("/ota", handleOTAPage);
   server.on("/events", HTTP_GET, handleSSE);
   server.on("/uploadStatus", HTTP_GET, handleUploadStatus);
+  server.on("/canstats", HTTP_GET, handleCanStats);
+  server.on("/unknownids", HTTP_GET, handleUnknownIds);
   server.on("/update", HTTP_POST, [](){
     // Dummy handler for POST request
   }, handleUpdateUpload);
@@ -246,6 +263,8 @@ void webpageSetup() {
   server.on("/ota", handleOTAPage);
   server.on("/events", HTTP_GET, handleSSE);
   server.on("/uploadStatus", HTTP_GET, handleUploadStatus);
+  server.on("/canstats", HTTP_GET, handleCanStats);
+  server.on("/unknownids", HTTP_GET, handleUnknownIds);
   server.on("/update", HTTP_POST, [](){
     // Dummy handler for POST request
   }, handleUpdateUpload);
@@ -0,0 +1,213 @@
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include "can_bits.h"
+
+// The built in signals, as the dash lays them out
+#define HT_NO_BIT CAN_NO_BIT
+#define HT_BITS(msb, length) CAN_BITS(msb, length)
+
+struct SpecRow
+{
+  const char *name;
+  uint8_t startByte;
+  uint8_t endByte;
+  bool isSigned;
+  uint8_t bitfieldPos;
+};
+
+static const SpecRow specRows[] = {
+#define HT_SIGNAL(name, shortName, id, canId, startByte, endByte, incomingUnit, scale, offset, updatePeriodMs, isSigned, bitfieldPos) \
+  {name, startByte, endByte, isSigned, bitfieldPos},
+#include "haltech_signals.def"
+#undef HT_SIGNAL
+};
+static const size_t specRowCount = sizeof(specRows) / sizeof(specRows[0]);
+
+// HaltechCan::extractValue() before can_bits replaced it, less the
+// undefined 32 bit shift it made sign extending a 4 byte field
+static uint32_t baselineExtractValue(const uint8_t *buffer, uint8_t start_byte, uint8_t end_byte, bool is_signed)
+{
+  uint32_t result = 0;
+  uint8_t num_bytes = end_byte - start_byte + 1;
+
+  for (int i = start_byte; i <= end_byte; i++) {
+    result = (result << 8) | buffer[i];
+  }
+
+  if (is_signed && num_bytes < 4) {
+    uint8_t num_bits = num_bytes * 8;
+    if (result & (1UL << (num_bits - 1))) {
+      result |= 0xFFFFFFFF << num_bits;
+    }
+  }
+  return result;
+}
+
+// What the baseline made of a row: flags are one bit of start_byte. Fields
+// narrower than their bytes, which the baseline decoded as whole bytes, are
+// the bits Haltech documents: length bits from bit msb of start_byte,
+// ending at bit 0 of end_byte.
+static int32_t baselineDecode(const SpecRow &row, const uint8_t *data)
+{
+  if (row.bitfieldPos != HT_NO_BIT) {
+    uint8_t msb = row.bitfieldPos & 7;
+    uint8_t length = (row.bitfieldPos >> 3) + 1;
+    uint32_t bytes = baselineExtractValue(data, row.startByte, row.endByte, false);
+    uint8_t shift = (row.endByte - row.startByte) * 8 + msb + 1 - length;
+    return (bytes >> shift) & ((1UL << length) - 1);
+  }
+  return (int32_t)baselineExtractValue(data, row.startByte, row.endByte, row.isSigned);
+}
+
+static const uint8_t payloads[][8] = {
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+  {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+  {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF},
+  {0xFE, 0xDC, 0xBA, 0x98, 0x76, 0x54, 0x32, 0x10},
+  {0x80, 0x01, 0x7F, 0xFE, 0x55, 0xAA, 0x0F, 0xF0},
+  {0xA5, 0x5A, 0x3C, 0xC3, 0x96, 0x69, 0x81, 0x18},
+};
+static const size_t payloadCount = sizeof(payloads) / sizeof(payloads[0]);
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Every built in signal of whole bytes or one bit gets a straight-line
+// decoder; the few fields of other widths go through extractBits()
+void test_spec_rows_have_specialized_decoders(void)
+{
+  for (size_t i = 0; i < specRowCount; i++) {
+    const SpecRow &row = specRows[i];
+    CanBitLayout layout = byteFieldLayout(row.startByte, row.endByte, row.bitfieldPos);
+    if (layout.length % 8 != 0 && layout.length != 1) {
+      continue;
+    }
+    TEST_ASSERT_NOT_NULL_MESSAGE(specializedDecoder(layout.startBit, layout.length, CAN_BIG_ENDIAN, row.isSigned), row.name);
+  }
+}
+
+// Haltech's sub-byte fields take only their documented bits
+void test_sub_byte_fields(void)
+{
+  const uint8_t data[8] = {0, 0, 0, 0, 0, 0, 0xA5, 0x3C};
+  struct
+  {
+    CanBitLayout layout;
+    int32_t expected;
+  } fields[] = {
+    {byteFieldLayout(6, 6, CAN_BITS(7, 4)), 0xA},   // Cruise control state, 6:7..6:4
+    {byteFieldLayout(6, 7, CAN_BITS(3, 12)), 0x53C}, // Cruise control input state, 6:3..7:0
+    {byteFieldLayout(7, 7, CAN_BITS(3, 4)), 0xC},   // Cut percentage method, 7:3..7:0
+  };
+  for (auto &field : fields) {
+    TEST_ASSERT_EQUAL_INT32(field.expected, extractBits(data, field.layout.startBit, field.layout.length, CAN_BIG_ENDIAN, false));
+  }
+}
+
+void test_spec_rows_decode_like_baseline(void)
+{
+  for (size_t p = 0; p < payloadCount; p++) {
+    for (size_t i = 0; i < specRowCount; i++) {
+      const SpecRow &row = specRows[i];
+      CanBitLayout layout = byteFieldLayout(row.startByte, row.endByte, row.bitfieldPos);
+      int32_t expected = baselineDecode(row, payloads[p]);
+
+      SignalDecoder decode = specializedDecoder(layout.startBit, layout.length, CAN_BIG_ENDIAN, row.isSigned);
+      if (decode != nullptr) {
+        TEST_ASSERT_EQUAL_INT32_MESSAGE(expected, decode(payloads[p]), row.name);
+      }
+      TEST_ASSERT_EQUAL_INT32_MESSAGE(expected, extractBits(payloads[p], layout.startBit, layout.length, CAN_BIG_ENDIAN, row.isSigned), row.name);
+    }
+  }
+}
+
+// Flags whose byte has a neighbouring bit set still read as their own bit
+void test_flags_ignore_neighbouring_bits(void)
+{
+  for (uint8_t bit = 0; bit < 8; bit++) {
+    CanBitLayout layout = byteFieldLayout(3, 3, bit);
+    SignalDecoder decode = specializedDecoder(layout.startBit, layout.length, CAN_BIG_ENDIAN, false);
+    uint8_t data[8] = {};
+    data[3] = 0xFF & ~(1 << bit);
+    TEST_ASSERT_EQUAL_INT32(0, decode(data));
+    data[3] = 1 << bit;
+    TEST_ASSERT_EQUAL_INT32(1, decode(data));
+  }
+}
+
+// The specialised decoders agree with extractBits() for every layout they cover
+void test_specialized_decoders_match_extract_bits(void)
+{
+  const CanByteOrder_e orders[] = {CAN_BIG_ENDIAN, CAN_LITTLE_ENDIAN};
+  for (CanByteOrder_e order : orders) {
+    for (uint8_t startBit = 0; startBit < 64; startBit++) {
+      for (uint8_t length = 1; length <= 32; length++) {
+        for (uint8_t isSigned = 0; isSigned < 2; isSigned++) {
+          SignalDecoder decode = specializedDecoder(startBit, length, order, isSigned);
+          if (decode == nullptr) {
+            continue;
+          }
+          for (size_t p = 0; p < payloadCount; p++) {
+            char message[48];
+            snprintf(message, sizeof(message), "order %d start %u length %u", order, startBit, length);
+            TEST_ASSERT_EQUAL_INT32_MESSAGE(extractBits(payloads[p], startBit, length, order, isSigned), decode(payloads[p]), message);
+          }
+        }
+      }
+    }
+  }
+}
+
+// Decodes every spec row the baseline way and through the specialised
+// decoders, and reports the time per signal. Host timings only show the
+// relative cost; the dash reports its own with the 'c' serial command.
+void test_decode_benchmark(void)
+{
+  static const uint32_t passes = 20000;
+  static SignalDecoder decoders[specRowCount];
+  static CanBitLayout layouts[specRowCount];
+  for (size_t i = 0; i < specRowCount; i++) {
+    layouts[i] = byteFieldLayout(specRows[i].startByte, specRows[i].endByte, specRows[i].bitfieldPos);
+    decoders[i] = specializedDecoder(layouts[i].startBit, layouts[i].length, CAN_BIG_ENDIAN, specRows[i].isSigned);
+  }
+
+  volatile int32_t sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    const uint8_t *data = payloads[pass % payloadCount];
+    for (size_t i = 0; i < specRowCount; i++) {
+      sink = sink + baselineDecode(specRows[i], data);
+    }
+  }
+  auto loopDone = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    const uint8_t *data = payloads[pass % payloadCount];
+    for (size_t i = 0; i < specRowCount; i++) {
+      // As the dispatch loop does, for the fields with no specialised decoder
+      sink = sink + (decoders[i] != nullptr ? decoders[i](data)
+                                            : extractBits(data, layouts[i].startBit, layouts[i].length, CAN_BIG_ENDIAN, specRows[i].isSigned));
+    }
+  }
+  auto specializedDone = std::chrono::steady_clock::now();
+
+  double decodes = (double)passes * specRowCount;
+  double loopNs = std::chrono::duration<double, std::nano>(loopDone - start).count() / decodes;
+  double specializedNs = std::chrono::duration<double, std::nano>(specializedDone - loopDone).count() / decodes;
+  char message[96];
+  snprintf(message, sizeof(message), "%u signals: byte loop %.2f ns, specialised %.2f ns per signal",
+           (unsigned)specRowCount, loopNs, specializedNs);
+  TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_spec_rows_have_specialized_decoders);
+  RUN_TEST(test_spec_rows_decode_like_baseline);
+  RUN_TEST(test_sub_byte_fields);
+  RUN_TEST(test_flags_ignore_neighbouring_bits);
+  RUN_TEST(test_specialized_decoders_match_extract_bits);
+  RUN_TEST(test_decode_benchmark);
+  return UNITY_END();
+}
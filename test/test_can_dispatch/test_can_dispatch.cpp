@@ -0,0 +1,132 @@
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include "can_id_hash.h"
+
+#define CAN_STD_ID_COUNT 0x800
+
+// The CAN ID of every built in signal
+struct SpecRow
+{
+  const char *name;
+  uint16_t canId;
+};
+
+static constexpr SpecRow specRows[] = {
+#define HT_SIGNAL(name, shortName, id, canId, startByte, endByte, incomingUnit, scale, offset, updatePeriodMs, isSigned, bitfieldPos) \
+  {name, canId},
+#include "haltech_signals.def"
+#undef HT_SIGNAL
+};
+static constexpr uint16_t specRowCount = sizeof(specRows) / sizeof(specRows[0]);
+static constexpr CanIdHash specHash = findCanIdHash(specRows, specRowCount);
+static_assert(specHash.multiplier != 0, "No perfect hash for the built in signals' IDs");
+
+// The hash slots as HaltechCan lays them out: the ID owning each slot and
+// how many signals it carries
+static uint16_t slotIds[CAN_ID_HASH_SLOTS];
+static uint8_t slotCounts[CAN_ID_HASH_SLOTS];
+
+static void buildSlots()
+{
+  for (uint16_t slot = 0; slot < CAN_ID_HASH_SLOTS; slot++) {
+    slotIds[slot] = CAN_ID_HASH_EMPTY;
+    slotCounts[slot] = 0;
+  }
+  for (uint16_t i = 0; i < specRowCount; i++) {
+    uint8_t slot = canIdHashSlot(specHash, specRows[i].canId);
+    slotIds[slot] = specRows[i].canId;
+    slotCounts[slot]++;
+  }
+}
+
+// Signals carried by id, found the way HaltechCan::processCANData() did
+// before the dispatch table: by checking every signal
+static uint8_t scanSignalCount(uint16_t id)
+{
+  uint8_t count = 0;
+  for (uint16_t i = 0; i < specRowCount; i++) {
+    if (specRows[i].canId == id) {
+      count++;
+    }
+  }
+  return count;
+}
+
+// And through the hash
+static uint8_t hashedSignalCount(uint16_t id)
+{
+  uint8_t slot = canIdHashSlot(specHash, id);
+  return slotIds[slot] == id ? slotCounts[slot] : 0;
+}
+
+void setUp(void)
+{
+  buildSlots();
+}
+
+void tearDown(void) {}
+
+// Every standard ID finds the same signals either way, so IDs the dash
+// doesn't read are rejected by the hash
+void test_hash_finds_the_same_signals_as_a_scan(void)
+{
+  for (uint16_t id = 0; id < CAN_STD_ID_COUNT; id++) {
+    char message[32];
+    snprintf(message, sizeof(message), "ID 0x%03x", id);
+    TEST_ASSERT_EQUAL_INT32_MESSAGE(scanSignalCount(id), hashedSignalCount(id), message);
+  }
+}
+
+// Looks up the signals of a frame stream by scan and by hash, and reports
+// the time per frame. A quarter of the frames are IDs no signal is read
+// from, as on a bus shared with other ECUs. Host timings only show the
+// relative cost; the dash reports its own with the 'c' serial command.
+void test_dispatch_benchmark(void)
+{
+  static const uint32_t passes = 2000;
+  static uint16_t frameIds[CAN_ID_HASH_SLOTS * 2];
+  uint16_t frameCount = 0;
+  for (uint16_t slot = 0; slot < CAN_ID_HASH_SLOTS; slot++) {
+    if (slotIds[slot] != CAN_ID_HASH_EMPTY) {
+      frameIds[frameCount++] = slotIds[slot];
+    }
+  }
+  for (uint16_t id = 0x100, unknown = frameCount / 3; unknown > 0; id += 7) {
+    if (scanSignalCount(id) == 0) {
+      frameIds[frameCount++] = id;
+      unknown--;
+    }
+  }
+
+  volatile uint32_t sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    for (uint16_t i = 0; i < frameCount; i++) {
+      sink = sink + scanSignalCount(frameIds[i]);
+    }
+  }
+  auto scanDone = std::chrono::steady_clock::now();
+  for (uint32_t pass = 0; pass < passes; pass++) {
+    for (uint16_t i = 0; i < frameCount; i++) {
+      sink = sink + hashedSignalCount(frameIds[i]);
+    }
+  }
+  auto hashedDone = std::chrono::steady_clock::now();
+
+  double frames = (double)passes * frameCount;
+  double scanNs = std::chrono::duration<double, std::nano>(scanDone - start).count() / frames;
+  double hashedNs = std::chrono::duration<double, std::nano>(hashedDone - scanDone).count() / frames;
+  char message[112];
+  snprintf(message, sizeof(message), "%u signals, %u frame IDs: scan %.2f ns, hash %.2f ns per frame",
+           (unsigned)specRowCount, (unsigned)frameCount, scanNs, hashedNs);
+  TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_hash_finds_the_same_signals_as_a_scan);
+  RUN_TEST(test_dispatch_benchmark);
+  return UNITY_END();
+}
@@ -0,0 +1,262 @@
+#include <unity.h>
+#include <string.h>
+#include "sdo_server.h"
+#include "keypad_dictionary.h"
+
+#define LEGACY_NODE_ID 0x0C // The only keypad the original code answered for
+
+static const char deviceName[] = "NuclearDash keypad"; // 18 bytes, three segments
+
+static constexpr SdoObject segmentedDictionary[] = {
+  {0x1008, 0x00, 0, sizeof(deviceName) - 1, 0, deviceName},
+  {0x1018, 0x01, 0, 4,                      0x00000307, nullptr},
+};
+
+static SdoServer server;
+static uint8_t reply[8];
+
+// The keypad branch of HaltechCan::processCANData() before SdoServer
+// replaced it. It sent a reply, possibly all zeros, to every request.
+static void legacyReply(const uint8_t *rxBuf, uint8_t *txBuf)
+{
+  memset(txBuf, 0, 8);
+  if ((rxBuf[0]) == 0x22) {
+    txBuf[0] = 0x60;
+    txBuf[1] = (rxBuf[1]);
+    txBuf[2] = (rxBuf[2]);
+    txBuf[3] = (rxBuf[3]);
+  } else if ((rxBuf[0]) == 0x42) {
+    txBuf[0] = 0x43;
+    txBuf[1] = (rxBuf[1]);
+    txBuf[2] = (rxBuf[2]);
+    txBuf[3] = (rxBuf[3]);
+
+    if ((txBuf[1] == 0x18) && (txBuf[2] == 0x10)) {
+      if (txBuf[3] == 0x01) {
+        txBuf[4] = 0x07;
+        txBuf[5] = 0x03;
+      } else if (txBuf[3] == 0x02) {
+        txBuf[4] = 0x48;
+        txBuf[5] = 0x33;
+      } else if (txBuf[3] == 0x03) {
+        txBuf[4] = 0x01;
+      } else if (txBuf[3] == 0x04) {
+        txBuf[4] = 0xCF;
+        txBuf[5] = 0xB8;
+        txBuf[6] = 0x19;
+        txBuf[7] = 0x0C;
+      }
+    } else if ((txBuf[1] == 0x00) && (txBuf[2] == 0x18) && (txBuf[3] == 0x01)) {
+      txBuf[4] = 0x8C;
+      txBuf[5] = 0x01;
+      txBuf[7] = 0x40;
+    }
+  } else if (((rxBuf[0]) == 0x00) && ((rxBuf[7]) == 0xC8)) {
+    txBuf[0] = 0x80;
+    txBuf[4] = 0x01;
+    txBuf[6] = 0x04;
+    txBuf[7] = 0x05;
+  }
+}
+
+static void assertMatchesLegacy(const uint8_t *request)
+{
+  uint8_t expected[8];
+  legacyReply(request, expected);
+  TEST_ASSERT_TRUE(server.handleRequest(request, 8, reply));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, reply, 8);
+}
+
+static void assertAbort(uint16_t index, uint8_t subIndex, uint32_t code)
+{
+  const uint8_t expected[8] = {0x80, (uint8_t)index, (uint8_t)(index >> 8), subIndex,
+                               (uint8_t)code, (uint8_t)(code >> 8), (uint8_t)(code >> 16), (uint8_t)(code >> 24)};
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, reply, 8);
+}
+
+void setUp(void)
+{
+  server.begin(LEGACY_NODE_ID, 0, keypadDictionary, KEYPAD_OBJECT_COUNT);
+}
+
+void tearDown(void) {}
+
+void test_identity_reads_match_legacy(void)
+{
+  const uint8_t subIndices[] = {1, 2, 3, 4};
+  for (uint8_t subIndex : subIndices) {
+    const uint8_t request[8] = {0x42, 0x18, 0x10, subIndex, 0, 0, 0, 0};
+    assertMatchesLegacy(request);
+  }
+}
+
+void test_tpdo_cob_id_read_matches_legacy(void)
+{
+  const uint8_t request[8] = {0x42, 0x00, 0x18, 0x01, 0, 0, 0, 0};
+  assertMatchesLegacy(request);
+}
+
+void test_unknown_object_reads_zero_like_legacy(void)
+{
+  const uint8_t request[8] = {0x42, 0x00, 0x10, 0x00, 0, 0, 0, 0};
+  assertMatchesLegacy(request);
+}
+
+void test_expedited_write_matches_legacy(void)
+{
+  const uint8_t request[8] = {0x22, 0x17, 0x10, 0x00, 0xE8, 0x03, 0, 0};
+  assertMatchesLegacy(request);
+}
+
+// The ECU sends a download segment ending 0xC8 with no transfer open
+void test_stray_c8_segment_aborts_like_legacy(void)
+{
+  const uint8_t request[8] = {0x00, 0, 0, 0, 0, 0, 0, 0xC8};
+  assertMatchesLegacy(request);
+  assertAbort(0, 0, SDO_ABORT_COMMAND);
+}
+
+// Identity values offset by the keypad's node ID and index
+void test_expedited_read_adds_node_id_and_device_index(void)
+{
+  server.begin(0x0D, 1, keypadDictionary, KEYPAD_OBJECT_COUNT);
+
+  const uint8_t serialRequest[8] = {0x40, 0x18, 0x10, 0x04, 0, 0, 0, 0};
+  const uint8_t serialReply[8] = {0x43, 0x18, 0x10, 0x04, 0xD0, 0xB8, 0x19, 0x0C};
+  TEST_ASSERT_TRUE(server.handleRequest(serialRequest, 8, reply));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(serialReply, reply, 8);
+
+  const uint8_t cobIdRequest[8] = {0x40, 0x00, 0x18, 0x01, 0, 0, 0, 0};
+  const uint8_t cobIdReply[8] = {0x43, 0x00, 0x18, 0x01, 0x8D, 0x01, 0x00, 0x40};
+  TEST_ASSERT_TRUE(server.handleRequest(cobIdRequest, 8, reply));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(cobIdReply, reply, 8);
+}
+
+void test_short_frame_gets_no_reply(void)
+{
+  const uint8_t request[8] = {0x40, 0x18, 0x10, 0x01, 0, 0, 0, 0};
+  TEST_ASSERT_FALSE(server.handleRequest(request, 4, reply));
+}
+
+void test_segmented_upload(void)
+{
+  server.begin(LEGACY_NODE_ID, 0, segmentedDictionary, 2);
+
+  const uint8_t initiate[8] = {0x40, 0x08, 0x10, 0x00, 0, 0, 0, 0};
+  const uint8_t initiateReply[8] = {0x41, 0x08, 0x10, 0x00, 18, 0, 0, 0};
+  TEST_ASSERT_TRUE(server.handleRequest(initiate, 8, reply));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(initiateReply, reply, 8);
+
+  const uint8_t segment0[8] = {0x60, 0, 0, 0, 0, 0, 0, 0};
+  const uint8_t segment1[8] = {0x70, 0, 0, 0, 0, 0, 0, 0};
+  const uint8_t reply0[8] = {0x00, 'N', 'u', 'c', 'l', 'e', 'a', 'r'};
+  const uint8_t reply1[8] = {0x10, 'D', 'a', 's', 'h', ' ', 'k', 'e'};
+  const uint8_t reply2[8] = {0x05 | (3 << 1), 'y', 'p', 'a', 'd', 0, 0, 0}; // 4 bytes, last
+  TEST_ASSERT_TRUE(server.handleRequest(segment0, 8, reply));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(reply0, reply, 8);
+  TEST_ASSERT_TRUE(server.handleRequest(segment1, 8, reply));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(reply1, reply, 8);
+  TEST_ASSERT_TRUE(server.handleRequest(segment0, 8, reply));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(reply2, reply, 8);
+
+  // Transfer finished, so another segment request has nothing to continue
+  TEST_ASSERT_TRUE(server.handleRequest(segment1, 8, reply));
+  assertAbort(0, 0, SDO_ABORT_COMMAND);
+}
+
+void test_segmented_upload_toggle_error_aborts(void)
+{
+  server.begin(LEGACY_NODE_ID, 0, segmentedDictionary, 2);
+
+  const uint8_t initiate[8] = {0x40, 0x08, 0x10, 0x00, 0, 0, 0, 0};
+  const uint8_t segment0[8] = {0x60, 0, 0, 0, 0, 0, 0, 0};
+  TEST_ASSERT_TRUE(server.handleRequest(initiate, 8, reply));
+  TEST_ASSERT_TRUE(server.handleRequest(segment0, 8, reply));
+
+  // Toggle bit not alternated
+  TEST_ASSERT_TRUE(server.handleRequest(segment0, 8, reply));
+  assertAbort(0x1008, 0x00, SDO_ABORT_TOGGLE);
+
+  // The abort ends the transfer
+  TEST_ASSERT_TRUE(server.handleRequest(segment0, 8, reply));
+  assertAbort(0, 0, SDO_ABORT_COMMAND);
+}
+
+// Segmented writes are acknowledged with alternating toggles, not stored
+void test_segmented_download(void)
+{
+  const uint8_t initiate[8] = {0x21, 0x08, 0x10, 0x00, 10, 0, 0, 0};
+  const uint8_t initiateReply[8] = {0x60, 0x08, 0x10, 0x00, 0, 0, 0, 0};
+  TEST_ASSERT_TRUE(server.handleRequest(initiate, 8, reply));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(initiateReply, reply, 8);
+
+  const uint8_t segment0[8] = {0x00, 'N', 'u', 'c', 'l', 'e', 'a', 'r'};
+  const uint8_t segment1[8] = {0x10 | (4 << 1) | 0x01, 'D', 'a', 's', 0, 0, 0, 0};
+  const uint8_t reply0[8] = {0x20, 0, 0, 0, 0, 0, 0, 0};
+  const uint8_t reply1[8] = {0x30, 0, 0, 0, 0, 0, 0, 0};
+  TEST_ASSERT_TRUE(server.handleRequest(segment0, 8, reply));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(reply0, reply, 8);
+  TEST_ASSERT_TRUE(server.handleRequest(segment1, 8, reply));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(reply1, reply, 8);
+
+  // The last segment closed the transfer
+  TEST_ASSERT_TRUE(server.handleRequest(segment0, 8, reply));
+  assertAbort(0, 0, SDO_ABORT_COMMAND);
+}
+
+void test_segmented_download_toggle_error_aborts(void)
+{
+  const uint8_t initiate[8] = {0x21, 0x08, 0x10, 0x00, 14, 0, 0, 0};
+  const uint8_t segment1[8] = {0x10, 'N', 'u', 'c', 'l', 'e', 'a', 'r'};
+  TEST_ASSERT_TRUE(server.handleRequest(initiate, 8, reply));
+
+  // The first segment must have the toggle bit clear
+  TEST_ASSERT_TRUE(server.handleRequest(segment1, 8, reply));
+  assertAbort(0x1008, 0x00, SDO_ABORT_TOGGLE);
+}
+
+// Block transfers are refused with the request's index and subindex
+void test_block_transfers_abort(void)
+{
+  const uint8_t blockDownload[8] = {0xC6, 0x18, 0x10, 0x01, 0, 0, 0, 0};
+  TEST_ASSERT_TRUE(server.handleRequest(blockDownload, 8, reply));
+  assertAbort(0x1018, 0x01, SDO_ABORT_COMMAND);
+
+  const uint8_t blockUpload[8] = {0xA4, 0x18, 0x10, 0x02, 0x7F, 0, 0, 0};
+  TEST_ASSERT_TRUE(server.handleRequest(blockUpload, 8, reply));
+  assertAbort(0x1018, 0x02, SDO_ABORT_COMMAND);
+}
+
+// A client abort ends the transfer without a reply
+void test_client_abort_ends_transfer(void)
+{
+  server.begin(LEGACY_NODE_ID, 0, segmentedDictionary, 2);
+
+  const uint8_t initiate[8] = {0x40, 0x08, 0x10, 0x00, 0, 0, 0, 0};
+  const uint8_t abortRequest[8] = {0x80, 0x08, 0x10, 0x00, 0x00, 0x00, 0x04, 0x05};
+  const uint8_t segment0[8] = {0x60, 0, 0, 0, 0, 0, 0, 0};
+  TEST_ASSERT_TRUE(server.handleRequest(initiate, 8, reply));
+  TEST_ASSERT_FALSE(server.handleRequest(abortRequest, 8, reply));
+
+  TEST_ASSERT_TRUE(server.handleRequest(segment0, 8, reply));
+  assertAbort(0, 0, SDO_ABORT_COMMAND);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_identity_reads_match_legacy);
+  RUN_TEST(test_tpdo_cob_id_read_matches_legacy);
+  RUN_TEST(test_unknown_object_reads_zero_like_legacy);
+  RUN_TEST(test_expedited_write_matches_legacy);
+  RUN_TEST(test_stray_c8_segment_aborts_like_legacy);
+  RUN_TEST(test_expedited_read_adds_node_id_and_device_index);
+  RUN_TEST(test_short_frame_gets_no_reply);
+  RUN_TEST(test_segmented_upload);
+  RUN_TEST(test_segmented_upload_toggle_error_aborts);
+  RUN_TEST(test_segmented_download);
+  RUN_TEST(test_segmented_download_toggle_error_aborts);
+  RUN_TEST(test_block_transfers_abort);
+  RUN_TEST(test_client_abort_ends_transfer);
+  return UNITY_END();
+}